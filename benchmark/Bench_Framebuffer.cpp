@@ -0,0 +1,85 @@
+#include <benchmark/benchmark.h>
+
+#include <Render/Rasterizer.h>
+#include <Window/Framebuffer.h>
+
+using namespace render;
+
+namespace {
+    // {ширина, высота}
+    void frame_sizes(benchmark::internal::Benchmark* b) {
+        b->Args({640, 480})->Args({1920, 1080})->Args({3840, 2160});
+    }
+}
+
+// ========================================================
+// 1. Очистка
+// ========================================================
+
+static void BM_ClearFull(benchmark::State& state) {
+    Framebuffer fb(static_cast<uint32_t>(state.range(0)), static_cast<uint32_t>(state.range(1)));
+    for (auto _ : state) {
+        fb.clear_full(Color::black());
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(state.iterations() * state.range(0) * state.range(1) * 4);
+}
+BENCHMARK(BM_ClearFull)->Apply(frame_sizes);
+
+// Тот же цвет, между очистками изменён один тайл — работает ленивая очистка
+static void BM_ClearLazy(benchmark::State& state) {
+    Framebuffer fb(static_cast<uint32_t>(state.range(0)), static_cast<uint32_t>(state.range(1)));
+    fb.clear(Color::black());
+    for (auto _ : state) {
+        fb.set_pixel(10, 10, Color::red());
+        fb.clear(Color::black());
+        benchmark::ClobberMemory();
+    }
+}
+BENCHMARK(BM_ClearLazy)->Apply(frame_sizes);
+
+static void BM_ClearDepth(benchmark::State& state) {
+    Framebuffer fb(static_cast<uint32_t>(state.range(0)), static_cast<uint32_t>(state.range(1)));
+    for (auto _ : state) {
+        fb.clear_depth();
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(state.iterations() * state.range(0) * state.range(1) * 4);
+}
+BENCHMARK(BM_ClearDepth)->Apply(frame_sizes);
+
+// ========================================================
+// 2. Запись пикселей
+// ========================================================
+
+static void BM_SetPixel(benchmark::State& state) {
+    const int width = static_cast<int>(state.range(0));
+    const int height = static_cast<int>(state.range(1));
+    Framebuffer fb(static_cast<uint32_t>(width), static_cast<uint32_t>(height));
+    fb.clear(Color::black());
+    for (auto _ : state) {
+        for (int y = 0; y < height; ++y) {
+            for (int x = 0; x < width; ++x) {
+                fb.set_pixel(x, y, Color::white());
+            }
+        }
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * width * height);
+}
+BENCHMARK(BM_SetPixel)->Args({640, 480})->Args({1920, 1080});
+
+static void BM_FillSpan(benchmark::State& state) {
+    const int width = static_cast<int>(state.range(0));
+    const int height = static_cast<int>(state.range(1));
+    Framebuffer fb(static_cast<uint32_t>(width), static_cast<uint32_t>(height));
+    const std::uint32_t white = Color::white().to_rgba32();
+    for (auto _ : state) {
+        for (int y = 0; y < height; ++y) {
+            fb.fill_span(y, 0, width, white);
+        }
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * width * height);
+}
+BENCHMARK(BM_FillSpan)->Args({640, 480})->Args({1920, 1080});
@@ -0,0 +1,119 @@
+#include <benchmark/benchmark.h>
+
+#include <random>
+#include <vector>
+
+#include <Math/Matrix4.hpp>
+#include <Math/Transform.hpp>
+#include <Math/Vector3.hpp>
+#include <Math/Vector4.hpp>
+
+using namespace gmath;
+
+namespace {
+    Matrix4f sample_matrix() {
+        return Matrix4f::perspective(1.0f, 1.5f, 0.1f, 100.0f) *
+               Matrix4f::look_at({1.0f, 2.0f, 5.0f}, {0.0f, 0.0f, 0.0f}, {0.0f, 1.0f, 0.0f}) *
+               Matrix4f::rotation_y(0.3f);
+    }
+
+    std::vector<float> random_stream(std::size_t count, unsigned seed) {
+        std::mt19937 rng(seed);
+        std::uniform_real_distribution<float> value(-10.0f, 10.0f);
+        std::vector<float> result(count);
+        for (float& v : result) {
+            v = value(rng);
+        }
+        return result;
+    }
+}
+
+// ========================================================
+// 1. Matrix4
+// ========================================================
+
+static void BM_Matrix4Multiply(benchmark::State& state) {
+    Matrix4f a = sample_matrix();
+    const Matrix4f b = Matrix4f::translation({1.0f, 2.0f, 3.0f});
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(a);
+        Matrix4f c = a * b;
+        benchmark::DoNotOptimize(c);
+    }
+}
+BENCHMARK(BM_Matrix4Multiply);
+
+static void BM_Matrix4TimesVector4(benchmark::State& state) {
+    const Matrix4f m = sample_matrix();
+    Vector4f v(1.0f, 2.0f, 3.0f, 1.0f);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(v);
+        Vector4f r = m * v;
+        benchmark::DoNotOptimize(r);
+    }
+}
+BENCHMARK(BM_Matrix4TimesVector4);
+
+static void BM_Matrix4Inverse(benchmark::State& state) {
+    Matrix4f m = sample_matrix();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(m);
+        Matrix4f r = m.inverse();
+        benchmark::DoNotOptimize(r);
+    }
+}
+BENCHMARK(BM_Matrix4Inverse);
+
+// Пакетное преобразование SoA-потоков, число точек
+static void BM_TransformPoints(benchmark::State& state) {
+    const auto count = static_cast<std::size_t>(state.range(0));
+    const Matrix4f m = sample_matrix();
+    const auto x = random_stream(count, 1);
+    const auto y = random_stream(count, 2);
+    const auto z = random_stream(count, 3);
+    std::vector<float> ox(count), oy(count), oz(count), ow(count);
+    for (auto _ : state) {
+        batch::transform_points(m, x.data(), y.data(), z.data(), count, ox.data(), oy.data(), oz.data(), ow.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_TransformPoints)->RangeMultiplier(16)->Range(64, 1 << 20);
+
+// ========================================================
+// 2. Vector3 / Vector4
+// ========================================================
+
+static void BM_Vector3Cross(benchmark::State& state) {
+    Vector3f a(1.0f, 2.0f, 3.0f);
+    Vector3f b(-4.0f, 0.5f, 2.0f);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(a);
+        benchmark::DoNotOptimize(b);
+        Vector3f r = a.cross(b);
+        benchmark::DoNotOptimize(r);
+    }
+}
+BENCHMARK(BM_Vector3Cross);
+
+static void BM_Vector3Normalize(benchmark::State& state) {
+    Vector3f a(1.0f, 2.0f, 3.0f);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(a);
+        Vector3f r = a.normalized();
+        benchmark::DoNotOptimize(r);
+    }
+}
+BENCHMARK(BM_Vector3Normalize);
+
+static void BM_Vector4Dot(benchmark::State& state) {
+    Vector4f a(1.0f, 2.0f, 3.0f, 4.0f);
+    Vector4f b(-4.0f, 0.5f, 2.0f, 1.0f);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(a);
+        benchmark::DoNotOptimize(b);
+        float r = a.dot(b);
+        benchmark::DoNotOptimize(r);
+    }
+}
+BENCHMARK(BM_Vector4Dot);
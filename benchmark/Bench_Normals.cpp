@@ -0,0 +1,70 @@
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+#include <Light/Normal.hpp>
+#include <Math/Vector3.hpp>
+
+using namespace gmath;
+
+namespace {
+    // Сетка n x n четырёхугольников с волной по z
+    struct Grid {
+        std::vector<Vector3f> vertices;
+        std::vector<std::vector<int>> polygons;
+    };
+
+    Grid make_grid(int n) {
+        Grid grid;
+        grid.vertices.reserve(static_cast<size_t>(n + 1) * (n + 1));
+        for (int y = 0; y <= n; ++y) {
+            for (int x = 0; x <= n; ++x) {
+                grid.vertices.emplace_back(float(x), float(y), float((x * 7 + y * 13) % 5) * 0.1f);
+            }
+        }
+        grid.polygons.reserve(static_cast<size_t>(n) * n);
+        for (int y = 0; y < n; ++y) {
+            for (int x = 0; x < n; ++x) {
+                const int i = y * (n + 1) + x;
+                grid.polygons.push_back({i, i + 1, i + n + 2, i + n + 1});
+            }
+        }
+        return grid;
+    }
+}
+
+// Аргумент — сторона сетки: граней n * n
+
+static void BM_ComputeFaceNormals(benchmark::State& state) {
+    const Grid grid = make_grid(static_cast<int>(state.range(0)));
+    Normal<float> normal(grid.vertices.size(), grid.polygons.size());
+    for (auto _ : state) {
+        normal.compute_face_normals(grid.polygons, grid.vertices);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(grid.polygons.size()));
+}
+BENCHMARK(BM_ComputeFaceNormals)->RangeMultiplier(4)->Range(16, 1024)->UseRealTime();
+
+static void BM_ComputeVertexNormals(benchmark::State& state) {
+    const Grid grid = make_grid(static_cast<int>(state.range(0)));
+    Normal<float> normal(grid.vertices.size(), grid.polygons.size());
+    normal.compute_face_normals(grid.polygons, grid.vertices);
+    for (auto _ : state) {
+        normal.compute_vertex_normals(grid.polygons, grid.vertices);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(grid.vertices.size()));
+}
+BENCHMARK(BM_ComputeVertexNormals)->RangeMultiplier(4)->Range(16, 1024)->UseRealTime();
+
+static void BM_ComputeAll(benchmark::State& state) {
+    const Grid grid = make_grid(static_cast<int>(state.range(0)));
+    Normal<float> normal(grid.vertices.size(), grid.polygons.size());
+    for (auto _ : state) {
+        normal.compute_all(grid.polygons, grid.vertices, NormalWeighting::area);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(grid.polygons.size()));
+}
+BENCHMARK(BM_ComputeAll)->RangeMultiplier(4)->Range(16, 1024)->UseRealTime();
@@ -0,0 +1,105 @@
+#include <benchmark/benchmark.h>
+
+#include <random>
+#include <vector>
+
+#include <Math/Vector2.hpp>
+#include <Render/Rasterizer.h>
+#include <Render/ThreadPool.h>
+#include <Render/TiledRenderer.h>
+#include <Window/Framebuffer.h>
+
+using namespace render;
+using gmath::Vector2f;
+
+namespace {
+    constexpr uint32_t W = 1024;
+    constexpr uint32_t H = 1024;
+
+    struct Triangle {
+        Vector2f a, b, c;
+    };
+
+    // count прямоугольных треугольников с катетом size, случайно раскиданных по кадру
+    std::vector<Triangle> make_triangles(int count, float size) {
+        std::mt19937 rng(42);
+        std::uniform_real_distribution<float> x(0.0f, W - size);
+        std::uniform_real_distribution<float> y(0.0f, H - size);
+        std::vector<Triangle> triangles(static_cast<size_t>(count));
+        for (auto& t : triangles) {
+            const Vector2f origin(x(rng), y(rng));
+            t = {origin, {origin.x + size, origin.y}, {origin.x, origin.y + size}};
+        }
+        return triangles;
+    }
+}
+
+// ========================================================
+// 1. Один треугольник, размер — катет в пикселях
+// ========================================================
+
+static void BM_DrawTriangle(benchmark::State& state) {
+    const float size = static_cast<float>(state.range(0));
+    Framebuffer fb(W, H);
+    fb.clear(Color::black());
+    const Triangle t = make_triangles(1, size)[0];
+    for (auto _ : state) {
+        Rasterizer::draw_triangle(fb, t.a, t.b, t.c, Color::red());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(size * size / 2));
+    state.SetLabel("items = pixels");
+}
+BENCHMARK(BM_DrawTriangle)->RangeMultiplier(4)->Range(4, 1024);
+
+static void BM_DrawColoredTriangle(benchmark::State& state) {
+    const float size = static_cast<float>(state.range(0));
+    Framebuffer fb(W, H);
+    fb.clear(Color::black());
+    const Triangle t = make_triangles(1, size)[0];
+    for (auto _ : state) {
+        Rasterizer::draw_colored_triangle(fb, t.a, t.b, t.c, Color::red(), Color::green(), Color::blue());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(size * size / 2));
+    state.SetLabel("items = pixels");
+}
+BENCHMARK(BM_DrawColoredTriangle)->RangeMultiplier(4)->Range(4, 1024);
+
+// ========================================================
+// 2. Много треугольников: {число, размер}
+// ========================================================
+
+static void BM_DrawTriangles(benchmark::State& state) {
+    const auto triangles = make_triangles(static_cast<int>(state.range(0)), static_cast<float>(state.range(1)));
+    Framebuffer fb(W, H);
+    for (auto _ : state) {
+        fb.clear(Color::black());
+        for (const auto& t : triangles) {
+            Rasterizer::draw_colored_triangle(fb, t.a, t.b, t.c, Color::red(), Color::green(), Color::blue());
+        }
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    state.SetLabel("items = triangles");
+}
+BENCHMARK(BM_DrawTriangles)->ArgsProduct({{100, 1000, 10000}, {8, 32, 128}});
+
+static void BM_TiledRenderer(benchmark::State& state) {
+    const auto triangles = make_triangles(static_cast<int>(state.range(0)), static_cast<float>(state.range(1)));
+    ThreadPool pool;
+    TiledRenderer renderer(pool);
+    Framebuffer fb(W, H);
+    for (auto _ : state) {
+        fb.clear(Color::black());
+        renderer.begin_frame(fb);
+        for (const auto& t : triangles) {
+            renderer.draw_colored_triangle(t.a, t.b, t.c, Color::red(), Color::green(), Color::blue());
+        }
+        renderer.end_frame();
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    state.SetLabel("items = triangles");
+}
+BENCHMARK(BM_TiledRenderer)->ArgsProduct({{100, 1000, 10000}, {8, 32, 128}})->UseRealTime();
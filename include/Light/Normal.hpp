@@ -1,15 +1,486 @@
 #pragma once
 
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <optional>
+#include <span>
 #include <vector>
 #include <Math/Vector3.hpp>
+#include <Math/MeshView.hpp>
 #include <Math/MConcepts.hpp>
+#include <Math/Parallel.hpp>
 
 namespace gmath {
+    /**
+     * Вклад грани в нормаль вершины (compute_all)
+     */
+    enum class NormalWeighting {
+        uniform, // единичная нормаль грани
+        area,    // ненормированное векторное произведение — пропорционально площади
+        angle    // единичная нормаль * угол грани при вершине, не зависит от триангуляции
+    };
+
+    /**
+     * Нормали граней и вершин
+     *
+     * - нормали граней считаются пакетами по BATCH граней: координаты собираются
+     *   в локальные SoA-массивы, векторное произведение и нормализация идут
+     *   простыми циклами по пакету, которые компилятор векторизует
+     * - нормаль вершины собирается (gather) по смежности вершина -> грани (CSR),
+     *   каждую вершину пишет ровно один поток, гонок нет
+     * - большие меши делятся между потоками (gmath::parallel_for)
+     *
+     * Смежность строится при первом compute_vertex_normals, многопоточном compute_all
+     * или update_normals и переиспользуется (в том числе для частичного пересчёта),
+     * пока совпадают число вершин и углов граней. После изменения топологии
+     * с теми же размерами нужно вызвать invalidate_adjacency()
+     */
     template<is_float_double T>
     class Normal {
         private:
+            static constexpr size_t BATCH = 8;
+            // Меньше этого граней/вершин на поток не выделяется
+            static constexpr size_t GRAIN = 16384;
+
             std::vector<Vector3<T>> vertex_normals;
             std::vector<Vector3<T>> face_normals;
+
+            // Грани вершины v: adjacency_faces[adjacency_offsets[v] .. adjacency_offsets[v + 1])
+            std::vector<uint32_t> adjacency_offsets;
+            std::vector<uint32_t> adjacency_faces;
+
+            size_t thread_count = 0;
+
+            // Рабочие буферы update_normals, живут между вызовами
+            std::vector<uint32_t> face_stamps;
+            std::vector<uint32_t> vertex_stamps;
+            uint32_t stamp_generation = 0;
+            std::vector<uint32_t> dirty_faces;
+            std::vector<uint32_t> dirty_vertices;
+
+            // Взвешивание последнего compute_all; пусто после compute_face/vertex_normals
+            std::optional<NormalWeighting> last_weighting;
+
+            // Источники геометрии: одинаковый интерфейс для polygons и MeshView
+            struct PolygonSource {
+                const std::vector<std::vector<int>>& polygons;
+                const std::vector<Vector3<T>>& vertices;
+
+                size_t face_count() const { return polygons.size(); }
+                size_t vertex_count() const { return vertices.size(); }
+                uint32_t face_size(size_t face) const { return static_cast<uint32_t>(polygons[face].size()); }
+                uint32_t index(size_t face, uint32_t k) const { return static_cast<uint32_t>(polygons[face][k]); }
+                const Vector3<T>& vertex(uint32_t i) const { return vertices[i]; }
+
+                size_t corner_count() const {
+                    size_t corners = 0;
+                    for (const auto& polygon : polygons) {
+                        corners += polygon.size();
+                    }
+                    return corners;
+                }
+            };
+
+            struct ViewSource {
+                const MeshView<T>& mesh;
+
+                size_t face_count() const { return mesh.face_count; }
+                size_t vertex_count() const { return mesh.vertex_count; }
+                uint32_t face_size(size_t face) const { return mesh.face_end(face) - mesh.face_begin(face); }
+                uint32_t index(size_t face, uint32_t k) const { return mesh.indices[mesh.face_begin(face) + k]; }
+                Vector3<T> vertex(uint32_t i) const { return mesh.vertex(i); }
+
+                size_t corner_count() const {
+                    return mesh.face_count ? mesh.face_end(mesh.face_count - 1) - mesh.face_begin(0) : 0;
+                }
+            };
+
+            /**
+             * Нормализация пакета из count <= BATCH векторов, заданных по компонентам.
+             * Нулевой вектор остаётся нулевым
+             */
+            static void normalize_batch(T (&x)[BATCH], T (&y)[BATCH], T (&z)[BATCH]) {
+                T scale[BATCH];
+                for (size_t l = 0; l < BATCH; l++) {
+                    const T length = std::sqrt(x[l] * x[l] + y[l] * y[l] + z[l] * z[l]);
+                    scale[l] = length > T(0) ? T(1) / length : T(0);
+                }
+                for (size_t l = 0; l < BATCH; l++) {
+                    x[l] *= scale[l];
+                    y[l] *= scale[l];
+                    z[l] *= scale[l];
+                }
+            }
+
+            // Пакетный расчёт граней face_at(begin) .. face_at(end - 1)
+            template<typename Source, typename FaceAt>
+            void face_normals_range(const Source& source, size_t begin, size_t end, FaceAt face_at) {
+                T ax[BATCH], ay[BATCH], az[BATCH];
+                T bx[BATCH], by[BATCH], bz[BATCH];
+                T cx[BATCH], cy[BATCH], cz[BATCH];
+                T nx[BATCH], ny[BATCH], nz[BATCH];
+
+                for (size_t first = begin; first < end; first += BATCH) {
+                    const size_t count = std::min(BATCH, end - first);
+
+                    // 1. Сбор вершин в SoA. Вырожденные грани и хвост пакета — нули
+                    for (size_t l = 0; l < BATCH; l++) {
+                        const size_t face = l < count ? face_at(first + l) : 0;
+                        if (l < count && source.face_size(face) >= 3) {
+                            const Vector3<T> a = source.vertex(source.index(face, 0));
+                            const Vector3<T> b = source.vertex(source.index(face, 1));
+                            const Vector3<T> c = source.vertex(source.index(face, 2));
+                            ax[l] = a.x; ay[l] = a.y; az[l] = a.z;
+                            bx[l] = b.x; by[l] = b.y; bz[l] = b.z;
+                            cx[l] = c.x; cy[l] = c.y; cz[l] = c.z;
+                        } else {
+                            ax[l] = ay[l] = az[l] = bx[l] = by[l] = bz[l] = cx[l] = cy[l] = cz[l] = T(0);
+                        }
+                    }
+
+                    // 2. (B - A) x (C - A) по всему пакету
+                    for (size_t l = 0; l < BATCH; l++) {
+                        const T ux = bx[l] - ax[l], uy = by[l] - ay[l], uz = bz[l] - az[l];
+                        const T vx = cx[l] - ax[l], vy = cy[l] - ay[l], vz = cz[l] - az[l];
+                        nx[l] = uy * vz - uz * vy;
+                        ny[l] = uz * vx - ux * vz;
+                        nz[l] = ux * vy - uy * vx;
+                    }
+                    normalize_batch(nx, ny, nz);
+
+                    for (size_t l = 0; l < count; l++) {
+                        face_normals[face_at(first + l)] = Vector3<T>(nx[l], ny[l], nz[l]);
+                    }
+                }
+            }
+
+            // Сумма нормалей граней вокруг вершин vertex_at(begin) .. vertex_at(end - 1) + нормализация
+            template<typename VertexAt>
+            void vertex_normals_range(size_t begin, size_t end, VertexAt vertex_at) {
+                T x[BATCH], y[BATCH], z[BATCH];
+
+                for (size_t first = begin; first < end; first += BATCH) {
+                    const size_t count = std::min(BATCH, end - first);
+
+                    for (size_t l = 0; l < BATCH; l++) {
+                        T sx = T(0), sy = T(0), sz = T(0);
+                        if (l < count) {
+                            const size_t v = vertex_at(first + l);
+                            for (uint32_t k = adjacency_offsets[v]; k < adjacency_offsets[v + 1]; k++) {
+                                const Vector3<T>& n = face_normals[adjacency_faces[k]];
+                                sx += n.x;
+                                sy += n.y;
+                                sz += n.z;
+                            }
+                        }
+                        x[l] = sx;
+                        y[l] = sy;
+                        z[l] = sz;
+                    }
+                    normalize_batch(x, y, z);
+
+                    for (size_t l = 0; l < count; l++) {
+                        vertex_normals[vertex_at(first + l)] = Vector3<T>(x[l], y[l], z[l]);
+                    }
+                }
+            }
+
+            template<typename Source>
+            void build_adjacency(const Source& source) {
+                const size_t faces = source.face_count();
+                const size_t vertices = source.vertex_count();
+
+                // Сортировка подсчётом: число граней у вершины -> префиксная сумма -> раскладка
+                adjacency_offsets.assign(vertices + 1, 0);
+                for (size_t face = 0; face < faces; face++) {
+                    for (uint32_t k = 0, n = source.face_size(face); k < n; k++) {
+                        adjacency_offsets[source.index(face, k) + 1]++;
+                    }
+                }
+                for (size_t v = 0; v < vertices; v++) {
+                    adjacency_offsets[v + 1] += adjacency_offsets[v];
+                }
+
+                adjacency_faces.resize(adjacency_offsets[vertices]);
+                std::vector<uint32_t> cursor(adjacency_offsets.begin(), adjacency_offsets.end() - 1);
+                for (size_t face = 0; face < faces; face++) {
+                    for (uint32_t k = 0, n = source.face_size(face); k < n; k++) {
+                        adjacency_faces[cursor[source.index(face, k)]++] = static_cast<uint32_t>(face);
+                    }
+                }
+            }
+
+            template<typename Source>
+            bool adjacency_matches(const Source& source) const {
+                if (adjacency_offsets.size() != source.vertex_count() + 1) {
+                    return false;
+                }
+                return adjacency_faces.size() == source.corner_count();
+            }
+
+            /**
+             * Сумма векторных произведений веера грани: для многоугольника любой
+             * выпуклости — нормаль с длиной 2 * площадь, без нормализации
+             */
+            template<typename Source>
+            static Vector3<T> fan_sum(const Source& source, size_t face) {
+                const uint32_t n = source.face_size(face);
+                if (n < 3) {
+                    return Vector3<T>::Null();
+                }
+                const Vector3<T> origin = source.vertex(source.index(face, 0));
+                Vector3<T> previous = source.vertex(source.index(face, 1)) - origin;
+                Vector3<T> sum = Vector3<T>::Null();
+                for (uint32_t k = 2; k < n; k++) {
+                    const Vector3<T> current = source.vertex(source.index(face, k)) - origin;
+                    sum += previous.cross(current);
+                    previous = current;
+                }
+                return sum;
+            }
+
+            static Vector3<T> unit_of(const Vector3<T>& sum) {
+                const T length = sum.length();
+                return length > T(0) ? sum * (T(1) / length) : Vector3<T>::Null();
+            }
+
+            // Угол грани face при её k-м угле
+            template<typename Source>
+            static T corner_angle(const Source& source, size_t face, uint32_t k) {
+                const uint32_t n = source.face_size(face);
+                const Vector3<T> corner = source.vertex(source.index(face, k));
+                const Vector3<T> to_prev = source.vertex(source.index(face, (k + n - 1) % n)) - corner;
+                const Vector3<T> to_next = source.vertex(source.index(face, (k + 1) % n)) - corner;
+                return std::atan2(to_prev.cross(to_next).length(), to_prev.dot(to_next));
+            }
+
+            /**
+             * Вклад грани с суммой веера sum в вершину её k-го угла.
+             * Для uniform и angle unit — unit_of(sum), для area не нужен
+             */
+            template<typename Source>
+            static Vector3<T> contribution(
+                const Source& source, size_t face, uint32_t k,
+                const Vector3<T>& sum, const Vector3<T>& unit, NormalWeighting weighting
+            ) {
+                switch (weighting) {
+                    case NormalWeighting::uniform:
+                        return unit;
+                    case NormalWeighting::area:
+                        return sum;
+                    case NormalWeighting::angle:
+                        return unit * corner_angle(source, face, k);
+                }
+                return Vector3<T>::Null();
+            }
+
+            /**
+             * Один проход по граням: нормаль грани (нормализация — одна на грань)
+             * и её вклад в вершины, сразу в накапливаемые vertex_normals
+             */
+            template<typename Source>
+            void fused_faces(const Source& source, NormalWeighting weighting) {
+                for (size_t face = 0; face < source.face_count(); face++) {
+                    const Vector3<T> sum = fan_sum(source, face);
+                    const Vector3<T> unit = unit_of(sum);
+                    face_normals[face] = unit;
+                    for (uint32_t k = 0, n = source.face_size(face); k < n; k++) {
+                        vertex_normals[source.index(face, k)] += contribution(source, face, k, sum, unit, weighting);
+                    }
+                }
+            }
+
+            /**
+             * Взвешенный сбор по смежности для вершин vertex_at(begin) .. vertex_at(end - 1)
+             * + нормализация. sum_at(face) — сумма веера грани (fan_sum): сохранённая
+             * или посчитанная заново, вклад тот же, что в fused_faces, и в том же порядке граней
+             */
+            template<typename Source, typename SumAt, typename VertexAt>
+            void weighted_vertex_normals_range(
+                const Source& source, NormalWeighting weighting, SumAt sum_at,
+                size_t begin, size_t end, VertexAt vertex_at
+            ) {
+                T x[BATCH], y[BATCH], z[BATCH];
+
+                for (size_t first = begin; first < end; first += BATCH) {
+                    const size_t count = std::min(BATCH, end - first);
+
+                    for (size_t l = 0; l < BATCH; l++) {
+                        Vector3<T> normal = Vector3<T>::Null();
+                        if (l < count) {
+                            const uint32_t v = static_cast<uint32_t>(vertex_at(first + l));
+                            uint32_t previous_face = 0, corner = 0;
+                            for (uint32_t a = adjacency_offsets[v]; a < adjacency_offsets[v + 1]; a++) {
+                                const uint32_t face = adjacency_faces[a];
+                                // Грань с повторной вершиной идёт в смежности подряд: следующий её угол с v
+                                corner = a > adjacency_offsets[v] && face == previous_face ? corner + 1 : 0;
+                                while (source.index(face, corner) != v) {
+                                    corner++;
+                                }
+                                previous_face = face;
+
+                                const Vector3<T> sum = sum_at(face);
+                                const Vector3<T> unit = weighting == NormalWeighting::area ? sum : unit_of(sum);
+                                normal += contribution(source, face, corner, sum, unit, weighting);
+                            }
+                        }
+                        x[l] = normal.x;
+                        y[l] = normal.y;
+                        z[l] = normal.z;
+                    }
+                    normalize_batch(x, y, z);
+
+                    for (size_t l = 0; l < count; l++) {
+                        vertex_normals[vertex_at(first + l)] = Vector3<T>(x[l], y[l], z[l]);
+                    }
+                }
+            }
+
+            template<typename Source>
+            void compute_all_impl(const Source& source, NormalWeighting weighting) {
+                last_weighting = weighting;
+                const size_t faces = source.face_count();
+                const size_t vertices = vertex_normals.size();
+
+                if (chunk_count(faces, GRAIN, thread_count) <= 1) {
+                    // Вершины копятся прямо в vertex_normals, нормализуются один раз в конце
+                    std::fill(vertex_normals.begin(), vertex_normals.end(), Vector3<T>::Null());
+                    fused_faces(source, weighting);
+                    for (size_t first = 0; first < vertices; first += BATCH) {
+                        const size_t count = std::min(BATCH, vertices - first);
+                        T x[BATCH] = {}, y[BATCH] = {}, z[BATCH] = {};
+                        for (size_t l = 0; l < count; l++) {
+                            x[l] = vertex_normals[first + l].x;
+                            y[l] = vertex_normals[first + l].y;
+                            z[l] = vertex_normals[first + l].z;
+                        }
+                        normalize_batch(x, y, z);
+                        for (size_t l = 0; l < count; l++) {
+                            vertex_normals[first + l] = Vector3<T>(x[l], y[l], z[l]);
+                        }
+                    }
+                    return;
+                }
+
+                // Параллельно разброс по вершинам дал бы гонки: суммы веера без нормализации
+                // пишутся на место нормалей граней, вершины собирают их по смежности,
+                // грани нормализуются последними
+                if (!adjacency_matches(source)) {
+                    build_adjacency(source);
+                }
+                parallel_for(faces, GRAIN, thread_count, [&](size_t begin, size_t end) {
+                    for (size_t face = begin; face < end; face++) {
+                        face_normals[face] = fan_sum(source, face);
+                    }
+                });
+                const auto stored_sum = [this](size_t face) -> const Vector3<T>& { return face_normals[face]; };
+                parallel_for(vertices, GRAIN, thread_count, [&](size_t begin, size_t end) {
+                    weighted_vertex_normals_range(source, weighting, stored_sum, begin, end, identity);
+                });
+                parallel_for(faces, GRAIN, thread_count, [&](size_t begin, size_t end) {
+                    for (size_t face = begin; face < end; face++) {
+                        face_normals[face] = unit_of(face_normals[face]);
+                    }
+                });
+            }
+
+            static size_t identity(size_t i) {
+                return i;
+            }
+
+            /**
+             * Пересчёт после изменения вершин modified:
+             * грани, содержащие их, -> вершины этих граней
+             */
+            template<typename Source>
+            void update_impl(const Source& source, std::span<const uint32_t> modified) {
+                // Топология та же по контракту: полная проверка adjacency_matches была бы O(mesh)
+                if (adjacency_offsets.size() != source.vertex_count() + 1) {
+                    if (!last_weighting) {
+                        compute_face_normals_impl(source);
+                        compute_vertex_normals_impl(source);
+                        return;
+                    }
+                    // Однопоточный compute_all смежность не строит, а нормали после него актуальны
+                    build_adjacency(source);
+                }
+
+                // Отметки «уже в списке» без очистки O(mesh): поколение вместо bool
+                if (++stamp_generation == 0) {
+                    std::fill(face_stamps.begin(), face_stamps.end(), 0);
+                    std::fill(vertex_stamps.begin(), vertex_stamps.end(), 0);
+                    stamp_generation = 1;
+                }
+                face_stamps.resize(face_normals.size(), 0);
+                vertex_stamps.resize(vertex_normals.size(), 0);
+
+                dirty_faces.clear();
+                for (const uint32_t v : modified) {
+                    for (uint32_t k = adjacency_offsets[v]; k < adjacency_offsets[v + 1]; k++) {
+                        const uint32_t face = adjacency_faces[k];
+                        if (face_stamps[face] != stamp_generation) {
+                            face_stamps[face] = stamp_generation;
+                            dirty_faces.push_back(face);
+                        }
+                    }
+                }
+
+                dirty_vertices.clear();
+                for (const uint32_t face : dirty_faces) {
+                    for (uint32_t k = 0, n = source.face_size(face); k < n; k++) {
+                        const uint32_t v = source.index(face, k);
+                        if (vertex_stamps[v] != stamp_generation) {
+                            vertex_stamps[v] = stamp_generation;
+                            dirty_vertices.push_back(v);
+                        }
+                    }
+                }
+
+                // Грани и вершины считаются тем же способом, что и в последнем полном расчёте
+                const auto face_at = [this](size_t i) { return dirty_faces[i]; };
+                const auto vertex_at = [this](size_t i) { return dirty_vertices[i]; };
+                if (!last_weighting) {
+                    parallel_for(dirty_faces.size(), GRAIN, thread_count, [&](size_t begin, size_t end) {
+                        face_normals_range(source, begin, end, face_at);
+                    });
+                    parallel_for(dirty_vertices.size(), GRAIN, thread_count, [&](size_t begin, size_t end) {
+                        vertex_normals_range(begin, end, vertex_at);
+                    });
+                    return;
+                }
+
+                // Нормали граней хранятся нормированными: суммы веера соседних граней считаются заново
+                parallel_for(dirty_faces.size(), GRAIN, thread_count, [&](size_t begin, size_t end) {
+                    for (size_t i = begin; i < end; i++) {
+                        face_normals[face_at(i)] = unit_of(fan_sum(source, face_at(i)));
+                    }
+                });
+                const auto fresh_sum = [&source](size_t face) { return fan_sum(source, face); };
+                parallel_for(dirty_vertices.size(), GRAIN, thread_count, [&](size_t begin, size_t end) {
+                    weighted_vertex_normals_range(source, *last_weighting, fresh_sum, begin, end, vertex_at);
+                });
+            }
+
+            template<typename Source>
+            void compute_face_normals_impl(const Source& source) {
+                last_weighting.reset();
+                parallel_for(source.face_count(), GRAIN, thread_count, [&](size_t begin, size_t end) {
+                    face_normals_range(source, begin, end, identity);
+                });
+            }
+
+            template<typename Source>
+            void compute_vertex_normals_impl(const Source& source) {
+                last_weighting.reset();
+                if (!adjacency_matches(source)) {
+                    build_adjacency(source);
+                }
+                parallel_for(vertex_normals.size(), GRAIN, thread_count, [&](size_t begin, size_t end) {
+                    vertex_normals_range(begin, end, identity);
+                });
+            }
+
         public:
             Normal(size_t vertex_count, size_t face_count)
                 : vertex_normals(vertex_count, Vector3<T>::Null()),
@@ -24,53 +495,83 @@ namespace gmath {
                 return face_normals;
             }
 
+            /**
+             * Число потоков для больших мешей, 0 — по числу ядер
+             */
+            void set_thread_count(size_t threads) {
+                thread_count = threads;
+            }
+
+            // Сбросить кэш смежности (топология меша изменилась)
+            void invalidate_adjacency() {
+                adjacency_offsets.clear();
+                adjacency_faces.clear();
+            }
+
             void compute_face_normals(
                 const std::vector<std::vector<int>>& polygons,
                 const std::vector<Vector3<T>>& vertices
             ) {
-                //face_normals.clear();
-
-                for (size_t i = 0; i < polygons.size(); i++) {
-                    const auto& polygon = polygons[i];
-
-                    if (polygon.size() < 3) {
-                        face_normals[i] = Vector3<T>::Null();
-                        continue;
-                    }
-
-                    const Vector3<T> edge_A = vertices[polygon[0]];
-                    const Vector3<T> edge_B = vertices[polygon[1]];
-                    const Vector3<T> edge_C = vertices[polygon[2]];
-
-                    Vector3<T> edge_one = edge_B - edge_A;
-                    Vector3<T> edge_two = edge_C - edge_A;
-
-                    face_normals[i] = edge_one.cross(edge_two).normalized();
-                }
+                compute_face_normals_impl(PolygonSource{polygons, vertices});
             }
 
             void compute_vertex_normals(
             const std::vector<std::vector<int>>& polygons,
             const std::vector<Vector3<T>>& vertices
             ) {
-                //vertex_normals.clear();
+                compute_vertex_normals_impl(PolygonSource{polygons, vertices});
+            }
 
-                for (auto& vertex : vertex_normals) {
-                    vertex = Vector3<T>::Null();
-                }
+            /**
+             * То же для геометрии в плоских массивах (Mesh, кэш меша) — без копирования в polygons
+             */
+            void compute_face_normals(const MeshView<T>& mesh) {
+                compute_face_normals_impl(ViewSource{mesh});
+            }
 
-                for (size_t i = 0; i < polygons.size(); i++) {
-                    const auto& polygon = polygons[i];
-                    const Vector3<T>& local_face_normal = face_normals[i];
+            void compute_vertex_normals(const MeshView<T>& mesh) {
+                compute_vertex_normals_impl(ViewSource{mesh});
+            }
 
-                    for (int vertex_index : polygon) {
-                        vertex_normals[vertex_index] += local_face_normal;
-                    }
-                }
+            /**
+             * Нормали граней и вершин со взвешиванием weighting. Многоугольники триангулируются
+             * веером; нормаль грани — нормированная сумма нормалей треугольников веера
+             * (для треугольника совпадает с compute_face_normals).
+             *
+             * В один поток — один проход по граням: вклад грани (для area — сумма веера
+             * без нормализации) сразу добавляется в вершины, нормализация одна на грань
+             * и одна на вершину в конце; смежность не строится. Большие меши при нескольких
+             * потоках: суммы веера граней -> сбор по смежности -> нормализация граней,
+             * без буферов на поток размером с меш
+             */
+            void compute_all(
+                const std::vector<std::vector<int>>& polygons,
+                const std::vector<Vector3<T>>& vertices,
+                NormalWeighting weighting = NormalWeighting::area
+            ) {
+                compute_all_impl(PolygonSource{polygons, vertices}, weighting);
+            }
 
-                for (auto& vertex : vertex_normals) {
-                    vertex = vertex.normalized();
-                }
+            void compute_all(const MeshView<T>& mesh, NormalWeighting weighting = NormalWeighting::area) {
+                compute_all_impl(ViewSource{mesh}, weighting);
+            }
+
+            /**
+             * Обновить нормали после перемещения вершин modified (топология прежняя).
+             * Пересчитываются только грани, содержащие эти вершины, и вершины этих граней,
+             * со взвешиванием последнего compute_all (после compute_face/vertex_normals — uniform).
+             * Если смежность ещё не построена или не подходит, считается всё заново
+             */
+            void update_normals(
+                std::span<const uint32_t> modified,
+                const std::vector<std::vector<int>>& polygons,
+                const std::vector<Vector3<T>>& vertices
+            ) {
+                update_impl(PolygonSource{polygons, vertices}, modified);
+            }
+
+            void update_normals(std::span<const uint32_t> modified, const MeshView<T>& mesh) {
+                update_impl(ViewSource{mesh}, modified);
             }
         };
     };
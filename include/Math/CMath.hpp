@@ -0,0 +1,106 @@
+#pragma once
+
+/**
+ * @file CMath.hpp
+ * @brief constexpr-варианты функций <cmath>
+ *
+ * std::sqrt, std::sin, std::cos до C++26 не constexpr. Функции ниже
+ * при вычислении на этапе компиляции считают результат сами (метод Ньютона,
+ * ряд Тейлора), а во время выполнения вызывают std:: — в рантайме поведение
+ * и точность те же, что и раньше. Значения на этапе компиляции могут
+ * отличаться от std:: на последний бит
+ */
+
+#include <cmath>
+#include <limits>
+#include <numbers>
+#include <type_traits>
+
+#include "MConcepts.hpp"
+
+namespace gmath::cmath {
+
+    template<is_float_double T> constexpr T abs(T value) noexcept {
+        return value < T(0) ? -value : value;
+    }
+
+    /**
+     * @brief Квадратный корень
+     *
+     * На этапе компиляции — метод Ньютона от начального приближения >= sqrt(value):
+     * последовательность монотонно убывает, остановка, когда она перестаёт убывать
+     */
+    template<is_float_double T> constexpr T sqrt(T value) noexcept {
+        if (!std::is_constant_evaluated()) {
+            return std::sqrt(value);
+        }
+        if (value != value || value < T(0)) {
+            return std::numeric_limits<T>::quiet_NaN();
+        }
+        if (value == T(0) || value == std::numeric_limits<T>::infinity()) {
+            return value;
+        }
+        T current = value > T(1) ? value : T(1);
+        while (true) {
+            const T next = (current + value / current) / T(2);
+            if (next >= current) {
+                return current;
+            }
+            current = next;
+        }
+    }
+
+    namespace detail {
+        // Ряды Тейлора на [-pi, pi], считаются в double
+        constexpr double reduce_angle(double angle) noexcept {
+            constexpr double two_pi = 2.0 * std::numbers::pi;
+            const double turns = static_cast<double>(static_cast<long long>(angle / two_pi));
+            angle -= turns * two_pi;
+            if (angle > std::numbers::pi) angle -= two_pi;
+            if (angle < -std::numbers::pi) angle += two_pi;
+            return angle;
+        }
+
+        constexpr double sin_series(double x) noexcept {
+            double term = x;
+            double sum = x;
+            for (int n = 1; n < 30; ++n) {
+                term *= -x * x / double((2 * n) * (2 * n + 1));
+                sum += term;
+            }
+            return sum;
+        }
+
+        constexpr double cos_series(double x) noexcept {
+            double term = 1.0;
+            double sum = 1.0;
+            for (int n = 1; n < 30; ++n) {
+                term *= -x * x / double((2 * n - 1) * (2 * n));
+                sum += term;
+            }
+            return sum;
+        }
+    }
+
+    template<is_float_double T> constexpr T sin(T angle) noexcept {
+        if (!std::is_constant_evaluated()) {
+            return std::sin(angle);
+        }
+        return static_cast<T>(detail::sin_series(detail::reduce_angle(angle)));
+    }
+
+    template<is_float_double T> constexpr T cos(T angle) noexcept {
+        if (!std::is_constant_evaluated()) {
+            return std::cos(angle);
+        }
+        return static_cast<T>(detail::cos_series(detail::reduce_angle(angle)));
+    }
+
+    template<is_float_double T> constexpr T tan(T angle) noexcept {
+        if (!std::is_constant_evaluated()) {
+            return std::tan(angle);
+        }
+        const double x = detail::reduce_angle(angle);
+        return static_cast<T>(detail::sin_series(x) / detail::cos_series(x));
+    }
+}
@@ -0,0 +1,32 @@
+#pragma once
+
+/**
+ * @file Checks.hpp
+ * @brief Политика проверок gmath
+ *
+ * GMATH_CHECKS = 1: деление на ноль и выход за границы матрицы бросают исключения.
+ * GMATH_CHECKS = 0: проверок нет, операторы noexcept и без ветвлений —
+ * их можно встраивать и векторизовать во внутренних циклах.
+ *
+ * По умолчанию проверки включены в отладочной сборке (без NDEBUG);
+ * можно задать явно через -DGMATH_CHECKS=0/1. Значение должно быть одним
+ * для всех единиц трансляции программы
+ */
+
+#ifndef GMATH_CHECKS
+    #ifdef NDEBUG
+        #define GMATH_CHECKS 0
+    #else
+        #define GMATH_CHECKS 1
+    #endif
+#endif
+
+#if GMATH_CHECKS
+    #define GMATH_NOEXCEPT
+#else
+    #define GMATH_NOEXCEPT noexcept
+#endif
+
+namespace gmath {
+    inline constexpr bool checks_enabled = GMATH_CHECKS != 0;
+}
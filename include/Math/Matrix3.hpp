@@ -4,6 +4,8 @@
 #include <ostream>
 #include <stdexcept>
 
+#include "CMath.hpp"
+#include "Checks.hpp"
 #include "MConcepts.hpp"
 #include "Vector3.hpp"
 
@@ -16,17 +18,17 @@ namespace gmath {
      */
     template<is_float_double T> class Matrix3 {
     private:        
-        std::array<std::array<T, 3>, 3> data;
+        std::array<std::array<T, 3>, 3> data{};
         
     public:
 
-        Matrix3() {
+        constexpr Matrix3() {
             for (auto& row : data) {
                 row.fill(T(0));
             }
         }
                 
-        Matrix3(const T values[3][3]) {
+        constexpr Matrix3(const T values[3][3]) {
             for (int i = 0; i < 3; ++i) {
                 for (int j = 0; j < 3; ++j) {
                     data[i][j] = values[i][j];
@@ -38,7 +40,7 @@ namespace gmath {
          * @brief Создает единичную матрицу
          * @return Единичная матрица 3x3
          */
-        static Matrix3 edinich() {
+        static constexpr Matrix3 edinich() {
             Matrix3 mat;
             for (size_t i = 0; i < 3; ++i) {
                 mat.data[i][i] = T(1);
@@ -50,7 +52,7 @@ namespace gmath {
          * @brief Создает нулевую матрицу
          * @return Нулевая матрица 3x3
          */
-        static Matrix3 zero() {
+        static constexpr Matrix3 zero() {
             return Matrix3();
         }        
                 
@@ -61,9 +63,11 @@ namespace gmath {
          * @param col Столбец 
          * @return Элемент         
          */
-        const T& operator()(size_t row, size_t col) const {
-            if (row >= 3 || col >= 3) {
-                throw std::out_of_range("Out of range");             
+        constexpr const T& operator()(size_t row, size_t col) const GMATH_NOEXCEPT {
+            if constexpr (checks_enabled) {
+                if (row >= 3 || col >= 3) {
+                    throw std::out_of_range("Out of range");
+                }
             }
             return data[row][col];
         }                                
@@ -73,7 +77,7 @@ namespace gmath {
          * @param other Матрица для сложения
          * @return Результат
          */
-        Matrix3 operator+(const Matrix3& other) const {
+        constexpr Matrix3 operator+(const Matrix3& other) const {
             Matrix3 result;
             for (size_t i = 0; i < 3; ++i) {
                 for (size_t j = 0; j < 3; ++j) {
@@ -88,7 +92,7 @@ namespace gmath {
          * @param other Матрица для вычитания
          * @return Результат 
          */
-        Matrix3 operator-(const Matrix3& other) const {
+        constexpr Matrix3 operator-(const Matrix3& other) const {
             Matrix3 result;
             for (size_t i = 0; i < 3; ++i) {
                 for (size_t j = 0; j < 3; ++j) {
@@ -103,7 +107,7 @@ namespace gmath {
          * @param other Матрица для умножения
          * @return Результат 
          */
-        Matrix3 operator*(const Matrix3& other) const {
+        constexpr Matrix3 operator*(const Matrix3& other) const {
             Matrix3 result;
             for (size_t i = 0; i < 3; ++i) {
                 for (size_t j = 0; j < 3; ++j) {
@@ -122,7 +126,7 @@ namespace gmath {
          * @param vec Вектор для умножения
          * @return Результат (Vector)
          */
-        Vector3<T> operator*(const Vector3<T>& vec) const {
+        constexpr Vector3<T> operator*(const Vector3<T>& vec) const {
             return Vector3<T>(
                 data[0][0] * vec.x + data[0][1] * vec.y + data[0][2] * vec.z,
                 data[1][0] * vec.x + data[1][1] * vec.y + data[1][2] * vec.z,
@@ -135,7 +139,7 @@ namespace gmath {
          * @param scalar Скаляр для умножения
          * @return Результат 
          */
-        Matrix3 operator*(T scalar) const {
+        constexpr Matrix3 operator*(T scalar) const {
             Matrix3 result;
             for (size_t i = 0; i < 3; ++i) {
                 for (size_t j = 0; j < 3; ++j) {
@@ -150,9 +154,11 @@ namespace gmath {
          * @param scalar Скаляр для деления
          * @return Результат          
          */
-        Matrix3 operator/(T scalar) const {
-            if (scalar == T(0)) {
-                throw std::runtime_error("Division by zero");
+        constexpr Matrix3 operator/(T scalar) const GMATH_NOEXCEPT {
+            if constexpr (checks_enabled) {
+                if (scalar == T(0)) {
+                    throw std::runtime_error("Division by zero");
+                }
             }
             Matrix3 result;
             for (size_t i = 0; i < 3; ++i) {
@@ -163,7 +169,7 @@ namespace gmath {
             return result;
         }                
         
-        Matrix3& operator+=(const Matrix3& other) {
+        constexpr Matrix3& operator+=(const Matrix3& other) {
             for (size_t i = 0; i < 3; ++i) {
                 for (size_t j = 0; j < 3; ++j) {
                     data[i][j] += other.data[i][j];
@@ -172,7 +178,7 @@ namespace gmath {
             return *this;
         }
         
-        Matrix3& operator-=(const Matrix3& other) {
+        constexpr Matrix3& operator-=(const Matrix3& other) {
             for (size_t i = 0; i < 3; ++i) {
                 for (size_t j = 0; j < 3; ++j) {
                     data[i][j] -= other.data[i][j];
@@ -181,12 +187,12 @@ namespace gmath {
             return *this;
         }
         
-        Matrix3& operator*=(const Matrix3& other) {
+        constexpr Matrix3& operator*=(const Matrix3& other) {
             *this = *this * other;
             return *this;
         }
         
-        Matrix3& operator*=(T scalar) {
+        constexpr Matrix3& operator*=(T scalar) {
             for (size_t i = 0; i < 3; ++i) {
                 for (size_t j = 0; j < 3; ++j) {
                     data[i][j] *= scalar;
@@ -195,9 +201,11 @@ namespace gmath {
             return *this;
         }
         
-        Matrix3& operator/=(T scalar) {
-            if (scalar == T(0)) {
-                throw std::runtime_error("Division by zero");
+        constexpr Matrix3& operator/=(T scalar) GMATH_NOEXCEPT {
+            if constexpr (checks_enabled) {
+                if (scalar == T(0)) {
+                    throw std::runtime_error("Division by zero");
+                }
             }
             for (size_t i = 0; i < 3; ++i) {
                 for (size_t j = 0; j < 3; ++j) {
@@ -207,7 +215,7 @@ namespace gmath {
             return *this;
         }                
         
-        bool operator==(const Matrix3& other) const {
+        constexpr bool operator==(const Matrix3& other) const {
             for (size_t i = 0; i < 3; ++i) {
                 for (size_t j = 0; j < 3; ++j) {
                     if (data[i][j] != other.data[i][j]) {
@@ -218,7 +226,7 @@ namespace gmath {
             return true;
         }
         
-        bool operator!=(const Matrix3& other) const {
+        constexpr bool operator!=(const Matrix3& other) const {
             return !(*this == other);
         }
         
@@ -228,10 +236,10 @@ namespace gmath {
          * @param eps Погрешность 
          * @return Результат
          */
-        bool equals(const Matrix3& other, T eps = std::numeric_limits<T>::epsilon()) const {
+        constexpr bool equals(const Matrix3& other, T eps = std::numeric_limits<T>::epsilon()) const {
             for (size_t i = 0; i < 3; ++i) {
                 for (size_t j = 0; j < 3; ++j) {
-                    if (std::abs(data[i][j] - other.data[i][j]) > eps) {
+                    if (cmath::abs(data[i][j] - other.data[i][j]) > eps) {
                         return false;
                     }
                 }
@@ -243,7 +251,7 @@ namespace gmath {
          * @brief Возвращает транспонированную матрицу
          * @return Транспонированная матрица
          */
-        [[nodiscard]] Matrix3 transposed() const {
+        [[nodiscard]] constexpr Matrix3 transposed() const {
             Matrix3 result;
             for (size_t i = 0; i < 3; ++i) {
                 for (size_t j = 0; j < 3; ++j) {
@@ -256,7 +264,7 @@ namespace gmath {
         /**
          * @brief Транспонирует матрицу
          */
-        void transpose() {
+        constexpr void transpose() {
             *this = transposed();
         }                                                                                                                          
         
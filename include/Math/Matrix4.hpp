@@ -1,11 +1,18 @@
 #pragma once
 
 #include <array>
+#include <cmath>
+#include <limits>
 #include <ostream>
 #include <stdexcept>
+#include <type_traits>
 
+#include "CMath.hpp"
+#include "Checks.hpp"
 #include "MConcepts.hpp"
-#include "../../src/Math/Vector4.hpp"
+#include "Simd.hpp"
+#include "Vector3.hpp"
+#include "Vector4.hpp"
 
 namespace gmath {
 
@@ -13,20 +20,48 @@ namespace gmath {
      * @class Matrix4
      * @brief Шаблонный класс для работы с матрицами 4x4
      * @tparam T Тип элементов матрицы     
+     *
+     * Матрица умножается на вектор-столбец (M * v), перенос в последнем столбце.
+     * Все операции constexpr: матрицы камеры и проекции с известными параметрами
+     * считаются на этапе компиляции. SIMD-пути включаются только в рантайме
      */
     template<is_float_double T> class Matrix4 {
     private:        
-        std::array<std::array<T, 4>, 4> data;
+        std::array<std::array<T, 4>, 4> data{};
+
+        // 2x2 миноры строк 0-1 (s) и 2-3 (c), общие для determinant() и inverse()
+        struct Minors {
+            T s0, s1, s2, s3, s4, s5;
+            T c0, c1, c2, c3, c4, c5;
+        };
+
+        [[nodiscard]] constexpr Minors minors() const noexcept {
+            const auto& a = data;
+            return {
+                a[0][0] * a[1][1] - a[1][0] * a[0][1],
+                a[0][0] * a[1][2] - a[1][0] * a[0][2],
+                a[0][0] * a[1][3] - a[1][0] * a[0][3],
+                a[0][1] * a[1][2] - a[1][1] * a[0][2],
+                a[0][1] * a[1][3] - a[1][1] * a[0][3],
+                a[0][2] * a[1][3] - a[1][2] * a[0][3],
+                a[2][0] * a[3][1] - a[3][0] * a[2][1],
+                a[2][0] * a[3][2] - a[3][0] * a[2][2],
+                a[2][0] * a[3][3] - a[3][0] * a[2][3],
+                a[2][1] * a[3][2] - a[3][1] * a[2][2],
+                a[2][1] * a[3][3] - a[3][1] * a[2][3],
+                a[2][2] * a[3][3] - a[3][2] * a[2][3]
+            };
+        }
         
     public:
 
-        Matrix4() {
+        constexpr Matrix4() {
             for (auto& row : data) {
                 row.fill(T(0));
             }
         }
                 
-        Matrix4(const T values[4][4]) {
+        constexpr Matrix4(const T values[4][4]) {
             for (int i = 0; i < 4; ++i) {
                 for (int j = 0; j < 4; ++j) {
                     data[i][j] = values[i][j];
@@ -38,7 +73,7 @@ namespace gmath {
          * @brief Создает единичную матрицу
          * @return Единичная матрица 4x4
          */
-        static Matrix4 edinich() {
+        static constexpr Matrix4 edinich() {
             Matrix4 mat;
             for (size_t i = 0; i < 4; ++i) {
                 mat.data[i][i] = T(1);
@@ -50,8 +85,160 @@ namespace gmath {
          * @brief Создает нулевую матрицу
          * @return Нулевая матрица 4x4
          */
-        static Matrix4 zero() {
+        static constexpr Matrix4 zero() {
             return Matrix4();
+        }
+
+        /**
+         * @brief Матрица переноса
+         * @param offset Вектор переноса
+         */
+        static constexpr Matrix4 translation(const Vector3<T>& offset) {
+            Matrix4 mat = edinich();
+            mat.data[0][3] = offset.x;
+            mat.data[1][3] = offset.y;
+            mat.data[2][3] = offset.z;
+            return mat;
+        }
+
+        /**
+         * @brief Матрица масштабирования
+         * @param factors Коэффициенты по осям
+         */
+        static constexpr Matrix4 scale(const Vector3<T>& factors) {
+            Matrix4 mat;
+            mat.data[0][0] = factors.x;
+            mat.data[1][1] = factors.y;
+            mat.data[2][2] = factors.z;
+            mat.data[3][3] = T(1);
+            return mat;
+        }
+
+        /**
+         * @brief Поворот вокруг оси X
+         * @param angle Угол в радианах (против часовой стрелки, если смотреть с конца оси)
+         */
+        static constexpr Matrix4 rotation_x(T angle) {
+            const T c = cmath::cos(angle);
+            const T s = cmath::sin(angle);
+            Matrix4 mat = edinich();
+            mat.data[1][1] = c;
+            mat.data[1][2] = -s;
+            mat.data[2][1] = s;
+            mat.data[2][2] = c;
+            return mat;
+        }
+
+        /**
+         * @brief Поворот вокруг оси Y
+         * @param angle Угол в радианах
+         */
+        static constexpr Matrix4 rotation_y(T angle) {
+            const T c = cmath::cos(angle);
+            const T s = cmath::sin(angle);
+            Matrix4 mat = edinich();
+            mat.data[0][0] = c;
+            mat.data[0][2] = s;
+            mat.data[2][0] = -s;
+            mat.data[2][2] = c;
+            return mat;
+        }
+
+        /**
+         * @brief Поворот вокруг оси Z
+         * @param angle Угол в радианах
+         */
+        static constexpr Matrix4 rotation_z(T angle) {
+            const T c = cmath::cos(angle);
+            const T s = cmath::sin(angle);
+            Matrix4 mat = edinich();
+            mat.data[0][0] = c;
+            mat.data[0][1] = -s;
+            mat.data[1][0] = s;
+            mat.data[1][1] = c;
+            return mat;
+        }
+
+        /**
+         * @brief Поворот вокруг произвольной оси (формула Родрига)
+         * @param axis Ось поворота, нормализуется
+         * @param angle Угол в радианах
+         */
+        static constexpr Matrix4 rotation(const Vector3<T>& axis, T angle) {
+            const Vector3<T> a = axis.normalized();
+            const T c = cmath::cos(angle);
+            const T s = cmath::sin(angle);
+            const T t = T(1) - c;
+            Matrix4 mat = edinich();
+            mat.data[0][0] = t * a.x * a.x + c;
+            mat.data[0][1] = t * a.x * a.y - s * a.z;
+            mat.data[0][2] = t * a.x * a.z + s * a.y;
+            mat.data[1][0] = t * a.x * a.y + s * a.z;
+            mat.data[1][1] = t * a.y * a.y + c;
+            mat.data[1][2] = t * a.y * a.z - s * a.x;
+            mat.data[2][0] = t * a.x * a.z - s * a.y;
+            mat.data[2][1] = t * a.y * a.z + s * a.x;
+            mat.data[2][2] = t * a.z * a.z + c;
+            return mat;
+        }
+
+        /**
+         * @brief Перспективная проекция (правая система, камера смотрит вдоль -Z)
+         * @param fov_y Вертикальный угол обзора в радианах
+         * @param aspect Ширина / высота
+         * @param z_near Расстояние до ближней плоскости (> 0)
+         * @param z_far Расстояние до дальней плоскости
+         * @return Матрица в clip space: видимая область -w <= x, y, z <= w, как ждёт Clipper
+         */
+        static constexpr Matrix4 perspective(T fov_y, T aspect, T z_near, T z_far) {
+            const T f = T(1) / cmath::tan(fov_y / T(2));
+            Matrix4 mat;
+            mat.data[0][0] = f / aspect;
+            mat.data[1][1] = f;
+            mat.data[2][2] = (z_far + z_near) / (z_near - z_far);
+            mat.data[2][3] = T(2) * z_far * z_near / (z_near - z_far);
+            mat.data[3][2] = T(-1);
+            return mat;
+        }
+
+        /**
+         * @brief Ортографическая проекция параллелепипеда в куб [-1, 1]^3
+         */
+        static constexpr Matrix4 orthographic(T left, T right, T bottom, T top, T z_near, T z_far) {
+            Matrix4 mat = edinich();
+            mat.data[0][0] = T(2) / (right - left);
+            mat.data[1][1] = T(2) / (top - bottom);
+            mat.data[2][2] = T(-2) / (z_far - z_near);
+            mat.data[0][3] = -(right + left) / (right - left);
+            mat.data[1][3] = -(top + bottom) / (top - bottom);
+            mat.data[2][3] = -(z_far + z_near) / (z_far - z_near);
+            return mat;
+        }
+
+        /**
+         * @brief Матрица вида: переводит мир в систему камеры
+         * @param eye Положение камеры
+         * @param target Точка, в которую смотрит камера (переходит на ось -Z)
+         * @param up Примерное направление вверх
+         */
+        static constexpr Matrix4 look_at(const Vector3<T>& eye, const Vector3<T>& target, const Vector3<T>& up) {
+            const Vector3<T> forward = (target - eye).normalized();
+            const Vector3<T> side = forward.cross(up).normalized();
+            const Vector3<T> true_up = side.cross(forward);
+            Matrix4 mat = edinich();
+            mat.data[0][0] = side.x;
+            mat.data[0][1] = side.y;
+            mat.data[0][2] = side.z;
+            mat.data[1][0] = true_up.x;
+            mat.data[1][1] = true_up.y;
+            mat.data[1][2] = true_up.z;
+            mat.data[2][0] = -forward.x;
+            mat.data[2][1] = -forward.y;
+            mat.data[2][2] = -forward.z;
+            mat.data[0][3] = -side.dot(eye);
+            mat.data[1][3] = -true_up.dot(eye);
+            mat.data[2][3] = forward.dot(eye);
+            return mat;
         }        
                 
         /**
@@ -60,9 +247,11 @@ namespace gmath {
          * @param col Столбец 
          * @return Элемент         
          */
-        const T& operator()(size_t row, size_t col) const {
-            if (row >= 4 || col >= 4) {
-                throw std::out_of_range("Out of range");                
+        constexpr const T& operator()(size_t row, size_t col) const GMATH_NOEXCEPT {
+            if constexpr (checks_enabled) {
+                if (row >= 4 || col >= 4) {
+                    throw std::out_of_range("Out of range");
+                }
             }
             return data[row][col];
         }                                
@@ -72,7 +261,7 @@ namespace gmath {
          * @param other Матрица для сложения
          * @return Результат
          */
-        Matrix4 operator+(const Matrix4& other) const {
+        constexpr Matrix4 operator+(const Matrix4& other) const {
             Matrix4 result;
             for (size_t i = 0; i < 4; ++i) {
                 for (size_t j = 0; j < 4; ++j) {
@@ -87,7 +276,7 @@ namespace gmath {
          * @param other Матрица для вычитания
          * @return Результат 
          */
-        Matrix4 operator-(const Matrix4& other) const {
+        constexpr Matrix4 operator-(const Matrix4& other) const {
             Matrix4 result;
             for (size_t i = 0; i < 4; ++i) {
                 for (size_t j = 0; j < 4; ++j) {
@@ -97,12 +286,42 @@ namespace gmath {
             return result;
         }
         
+        /**
+         * @brief Элементы по строкам, 16 подряд идущих значений
+         */
+        [[nodiscard]] constexpr const T* values() const {
+            static_assert(sizeof(data) == 16 * sizeof(T));
+            return data[0].data();
+        }
+
         /**
          * @brief Умножение матриц
          * @param other Матрица для умножения
          * @return Результат 
+         *
+         * Для float на SSE строка результата = сумма строк other с весами из строки this,
+         * порядок сложений тот же, что в скалярном цикле
          */
-        Matrix4 operator*(const Matrix4& other) const {
+        constexpr Matrix4 operator*(const Matrix4& other) const {
+#if GMATH_SSE
+            if constexpr (std::is_same_v<T, float>) {
+                if (!std::is_constant_evaluated()) {
+                    Matrix4 result;
+                    const __m128 b0 = _mm_loadu_ps(other.data[0].data());
+                    const __m128 b1 = _mm_loadu_ps(other.data[1].data());
+                    const __m128 b2 = _mm_loadu_ps(other.data[2].data());
+                    const __m128 b3 = _mm_loadu_ps(other.data[3].data());
+                    for (size_t i = 0; i < 4; ++i) {
+                        __m128 row = _mm_mul_ps(_mm_set1_ps(data[i][0]), b0);
+                        row = _mm_add_ps(row, _mm_mul_ps(_mm_set1_ps(data[i][1]), b1));
+                        row = _mm_add_ps(row, _mm_mul_ps(_mm_set1_ps(data[i][2]), b2));
+                        row = _mm_add_ps(row, _mm_mul_ps(_mm_set1_ps(data[i][3]), b3));
+                        _mm_storeu_ps(result.data[i].data(), row);
+                    }
+                    return result;
+                }
+            }
+#endif
             Matrix4 result;
             for (size_t i = 0; i < 4; ++i) {
                 for (size_t j = 0; j < 4; ++j) {
@@ -121,7 +340,26 @@ namespace gmath {
          * @param vec Вектор для умножения
          * @return Результат (Vector)
          */
-        Vector4<T> operator*(const Vector4<T>& vec) const {
+        constexpr Vector4<T> operator*(const Vector4<T>& vec) const {
+#if GMATH_SSE
+            if constexpr (std::is_same_v<T, float>) {
+                if (!std::is_constant_evaluated()) {
+                    // Столбцы * компоненты вектора: ((c0 x + c1 y) + c2 z) + c3 w
+                    __m128 c0 = _mm_loadu_ps(data[0].data());
+                    __m128 c1 = _mm_loadu_ps(data[1].data());
+                    __m128 c2 = _mm_loadu_ps(data[2].data());
+                    __m128 c3 = _mm_loadu_ps(data[3].data());
+                    _MM_TRANSPOSE4_PS(c0, c1, c2, c3);
+                    __m128 r = _mm_mul_ps(c0, _mm_set1_ps(vec.x));
+                    r = _mm_add_ps(r, _mm_mul_ps(c1, _mm_set1_ps(vec.y)));
+                    r = _mm_add_ps(r, _mm_mul_ps(c2, _mm_set1_ps(vec.z)));
+                    r = _mm_add_ps(r, _mm_mul_ps(c3, _mm_set1_ps(vec.w)));
+                    alignas(16) float out[4];
+                    _mm_store_ps(out, r);
+                    return Vector4<T>(out[0], out[1], out[2], out[3]);
+                }
+            }
+#endif
             return Vector4<T>(
                 data[0][0] * vec.x + data[0][1] * vec.y + data[0][2] * vec.z + data[0][3] * vec.w,
                 data[1][0] * vec.x + data[1][1] * vec.y + data[1][2] * vec.z + data[1][3] * vec.w,
@@ -135,7 +373,7 @@ namespace gmath {
          * @param scalar Скаляр для умножения
          * @return Результат 
          */
-        Matrix4 operator*(T scalar) const {
+        constexpr Matrix4 operator*(T scalar) const {
             Matrix4 result;
             for (size_t i = 0; i < 4; ++i) {
                 for (size_t j = 0; j < 4; ++j) {
@@ -150,9 +388,11 @@ namespace gmath {
          * @param scalar Скаляр для деления
          * @return Результат          
          */
-        Matrix4 operator/(T scalar) const {
-            if (scalar == T(0)) {
-                throw std::runtime_error("Division by zero");
+        constexpr Matrix4 operator/(T scalar) const GMATH_NOEXCEPT {
+            if constexpr (checks_enabled) {
+                if (scalar == T(0)) {
+                    throw std::runtime_error("Division by zero");
+                }
             }
             Matrix4 result;
             for (size_t i = 0; i < 4; ++i) {
@@ -163,7 +403,7 @@ namespace gmath {
             return result;
         }                
         
-        Matrix4& operator+=(const Matrix4& other) {
+        constexpr Matrix4& operator+=(const Matrix4& other) {
             for (size_t i = 0; i < 4; ++i) {
                 for (size_t j = 0; j < 4; ++j) {
                     data[i][j] += other.data[i][j];
@@ -172,7 +412,7 @@ namespace gmath {
             return *this;
         }
         
-        Matrix4& operator-=(const Matrix4& other) {
+        constexpr Matrix4& operator-=(const Matrix4& other) {
             for (size_t i = 0; i < 4; ++i) {
                 for (size_t j = 0; j < 4; ++j) {
                     data[i][j] -= other.data[i][j];
@@ -181,12 +421,12 @@ namespace gmath {
             return *this;
         }
         
-        Matrix4& operator*=(const Matrix4& other) {
+        constexpr Matrix4& operator*=(const Matrix4& other) {
             *this = *this * other;
             return *this;
         }
         
-        Matrix4& operator*=(T scalar) {
+        constexpr Matrix4& operator*=(T scalar) {
             for (size_t i = 0; i < 4; ++i) {
                 for (size_t j = 0; j < 4; ++j) {
                     data[i][j] *= scalar;
@@ -195,9 +435,11 @@ namespace gmath {
             return *this;
         }
         
-        Matrix4& operator/=(T scalar) {
-            if (scalar == T(0)) {
-                throw std::runtime_error("Division by zero");
+        constexpr Matrix4& operator/=(T scalar) GMATH_NOEXCEPT {
+            if constexpr (checks_enabled) {
+                if (scalar == T(0)) {
+                    throw std::runtime_error("Division by zero");
+                }
             }
             for (size_t i = 0; i < 4; ++i) {
                 for (size_t j = 0; j < 4; ++j) {
@@ -207,7 +449,7 @@ namespace gmath {
             return *this;
         }                
         
-        bool operator==(const Matrix4& other) const {
+        constexpr bool operator==(const Matrix4& other) const {
             for (size_t i = 0; i < 4; ++i) {
                 for (size_t j = 0; j < 4; ++j) {
                     if (data[i][j] != other.data[i][j]) {
@@ -218,7 +460,7 @@ namespace gmath {
             return true;
         }
         
-        bool operator!=(const Matrix4& other) const {
+        constexpr bool operator!=(const Matrix4& other) const {
             return !(*this == other);
         }
         
@@ -228,10 +470,10 @@ namespace gmath {
          * @param eps Погрешность 
          * @return Результат
          */
-        bool equals(const Matrix4& other, T eps = std::numeric_limits<T>::epsilon()) const {
+        constexpr bool equals(const Matrix4& other, T eps = std::numeric_limits<T>::epsilon()) const {
             for (size_t i = 0; i < 4; ++i) {
                 for (size_t j = 0; j < 4; ++j) {
-                    if (std::abs(data[i][j] - other.data[i][j]) > eps) {
+                    if (cmath::abs(data[i][j] - other.data[i][j]) > eps) {
                         return false;
                     }
                 }
@@ -243,7 +485,7 @@ namespace gmath {
          * @brief Возвращает транспонированную матрицу
          * @return Транспонированная матрица
          */
-        [[nodiscard]] Matrix4 transposed() const {
+        [[nodiscard]] constexpr Matrix4 transposed() const {
             Matrix4 result;
             for (size_t i = 0; i < 4; ++i) {
                 for (size_t j = 0; j < 4; ++j) {
@@ -256,8 +498,56 @@ namespace gmath {
         /**
          * @brief Транспонирует матрицу
          */
-        void transpose() {
+        constexpr void transpose() {
             *this = transposed();
+        }
+
+        /**
+         * @brief Определитель
+         *
+         * Разложение по парам строк: 2x2 миноры верхних и нижних двух строк
+         */
+        [[nodiscard]] constexpr T determinant() const noexcept {
+            const Minors m = minors();
+            return m.s0 * m.c5 - m.s1 * m.c4 + m.s2 * m.c3 + m.s3 * m.c2 - m.s4 * m.c1 + m.s5 * m.c0;
+        }
+
+        /**
+         * @brief Обратная матрица через присоединённую
+         * @return Результат; для вырожденной матрицы при включённых проверках — исключение
+         */
+        [[nodiscard]] constexpr Matrix4 inverse() const GMATH_NOEXCEPT {
+            const Minors m = minors();
+            const T det = m.s0 * m.c5 - m.s1 * m.c4 + m.s2 * m.c3 + m.s3 * m.c2 - m.s4 * m.c1 + m.s5 * m.c0;
+            if constexpr (checks_enabled) {
+                if (det == T(0)) {
+                    throw std::runtime_error("Singular matrix");
+                }
+            }
+            const T inv_det = T(1) / det;
+            const auto& a = data;
+
+            Matrix4 result;
+            result.data[0][0] = ( a[1][1] * m.c5 - a[1][2] * m.c4 + a[1][3] * m.c3) * inv_det;
+            result.data[0][1] = (-a[0][1] * m.c5 + a[0][2] * m.c4 - a[0][3] * m.c3) * inv_det;
+            result.data[0][2] = ( a[3][1] * m.s5 - a[3][2] * m.s4 + a[3][3] * m.s3) * inv_det;
+            result.data[0][3] = (-a[2][1] * m.s5 + a[2][2] * m.s4 - a[2][3] * m.s3) * inv_det;
+
+            result.data[1][0] = (-a[1][0] * m.c5 + a[1][2] * m.c2 - a[1][3] * m.c1) * inv_det;
+            result.data[1][1] = ( a[0][0] * m.c5 - a[0][2] * m.c2 + a[0][3] * m.c1) * inv_det;
+            result.data[1][2] = (-a[3][0] * m.s5 + a[3][2] * m.s2 - a[3][3] * m.s1) * inv_det;
+            result.data[1][3] = ( a[2][0] * m.s5 - a[2][2] * m.s2 + a[2][3] * m.s1) * inv_det;
+
+            result.data[2][0] = ( a[1][0] * m.c4 - a[1][1] * m.c2 + a[1][3] * m.c0) * inv_det;
+            result.data[2][1] = (-a[0][0] * m.c4 + a[0][1] * m.c2 - a[0][3] * m.c0) * inv_det;
+            result.data[2][2] = ( a[3][0] * m.s4 - a[3][1] * m.s2 + a[3][3] * m.s0) * inv_det;
+            result.data[2][3] = (-a[2][0] * m.s4 + a[2][1] * m.s2 - a[2][3] * m.s0) * inv_det;
+
+            result.data[3][0] = (-a[1][0] * m.c3 + a[1][1] * m.c1 - a[1][2] * m.c0) * inv_det;
+            result.data[3][1] = ( a[0][0] * m.c3 - a[0][1] * m.c1 + a[0][2] * m.c0) * inv_det;
+            result.data[3][2] = (-a[3][0] * m.s3 + a[3][1] * m.s1 - a[3][2] * m.s0) * inv_det;
+            result.data[3][3] = ( a[2][0] * m.s3 - a[2][1] * m.s1 + a[2][2] * m.s0) * inv_det;
+            return result;
         }                                                                                                                                  
         
         friend std::ostream& operator<<(std::ostream& os, const Matrix4& mat) {
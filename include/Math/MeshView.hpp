@@ -0,0 +1,64 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "MConcepts.hpp"
+#include "Vector3.hpp"
+
+namespace gmath {
+
+    /**
+     * @class MeshView
+     * @brief Невладеющий взгляд на геометрию меша: координаты вершин и грани
+     * @tparam T Тип координат (float или double)
+     *
+     * Координаты задаются тремя указателями с общим шагом stride (в элементах T):
+     * SoA-потоки — stride = 1, массив Vector3<T> — x = &v[0].x, y = &v[0].y, z = &v[0].z, stride = 3.
+     *
+     * Грань i — индексы indices[face_offsets[i] .. face_offsets[i + 1]).
+     * Если face_offsets == nullptr, все грани — треугольники
+     */
+    template<is_float_double T> struct MeshView {
+        const T* x = nullptr;
+        const T* y = nullptr;
+        const T* z = nullptr;
+        std::size_t stride = 1;
+        std::size_t vertex_count = 0;
+
+        const std::uint32_t* indices = nullptr;
+        const std::uint32_t* face_offsets = nullptr;
+        std::size_t face_count = 0;
+
+        /**
+         * @brief Взгляд на массив Vector3<T> и плоский список треугольников
+         */
+        static MeshView triangles(
+            const Vector3<T>* vertices, std::size_t vertex_count,
+            const std::uint32_t* indices, std::size_t triangle_count
+        ) {
+            static_assert(sizeof(Vector3<T>) == 3 * sizeof(T));
+            MeshView view;
+            view.x = &vertices->x;
+            view.y = &vertices->y;
+            view.z = &vertices->z;
+            view.stride = 3;
+            view.vertex_count = vertex_count;
+            view.indices = indices;
+            view.face_count = triangle_count;
+            return view;
+        }
+
+        [[nodiscard]] Vector3<T> vertex(std::uint32_t i) const {
+            return Vector3<T>(x[i * stride], y[i * stride], z[i * stride]);
+        }
+
+        [[nodiscard]] std::uint32_t face_begin(std::size_t face) const {
+            return face_offsets ? face_offsets[face] : static_cast<std::uint32_t>(face * 3);
+        }
+
+        [[nodiscard]] std::uint32_t face_end(std::size_t face) const {
+            return face_offsets ? face_offsets[face + 1] : static_cast<std::uint32_t>(face * 3 + 3);
+        }
+    };
+}
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <thread>
+
+#include <Math/ThreadPool.hpp>
+
+namespace gmath {
+
+    /**
+     * @brief Число потоков по умолчанию для параллельных алгоритмов gmath
+     */
+    inline std::size_t default_thread_count() {
+        return std::max(1u, std::thread::hardware_concurrency());
+    }
+
+    /**
+     * @brief На сколько кусков делить [0, count)
+     * @param grain Минимальный размер куска
+     * @param threads Число потоков, 0 — default_thread_count()
+     */
+    inline std::size_t chunk_count(std::size_t count, std::size_t grain, std::size_t threads) {
+        if (threads == 0) {
+            threads = default_thread_count();
+        }
+        return std::min(threads, std::max<std::size_t>(1, count / std::max<std::size_t>(grain, 1)));
+    }
+
+    /**
+     * @brief Обрабатывает [0, count), разбитый на chunks непрерывных кусков, на общем пуле ThreadPool::shared()
+     * @param body Вызывается как body(chunk, begin, end); куски не пересекаются
+     *
+     * Вызывающий поток тоже берёт куски; исключение из body пробрасывается вызывающему
+     */
+    template<typename F>
+    void parallel_for_chunks(std::size_t count, std::size_t chunks, F&& body) {
+        if (chunks <= 1) {
+            body(std::size_t(0), std::size_t(0), count);
+            return;
+        }
+
+        ThreadPool::shared().parallel_for(chunks, [&body, chunks, count](std::size_t i) {
+            body(i, count * i / chunks, count * (i + 1) / chunks);
+        });
+    }
+
+    /**
+     * @brief Делит [0, count) на непрерывные куски и обрабатывает их на нескольких потоках
+     * @param grain Минимальный размер куска: меньшие диапазоны обрабатываются в вызывающем потоке
+     * @param threads Число потоков, 0 — default_thread_count()
+     * @param body Вызывается как body(begin, end); куски не пересекаются
+     */
+    template<typename F>
+    void parallel_for(std::size_t count, std::size_t grain, std::size_t threads, F&& body) {
+        parallel_for_chunks(count, chunk_count(count, grain, threads),
+            [&body](std::size_t, std::size_t begin, std::size_t end) {
+                body(begin, end);
+            });
+    }
+}
@@ -0,0 +1,49 @@
+#pragma once
+
+/**
+ * @file Simd.hpp
+ * @brief Настройка SIMD для gmath
+ *
+ * GMATH_SSE — 1, если доступны SSE2-интринсики (любой x86-64). На остальных
+ * платформах и при GMATH_NO_SIMD используется обычный скалярный код.
+ * AVX не требуется при сборке: функции с GMATH_TARGET_AVX вызываются
+ * только после проверки процессора (simd::has_avx)
+ */
+
+#if !defined(GMATH_NO_SIMD) && (defined(__x86_64__) || defined(_M_X64))
+    #define GMATH_SSE 1
+    #include <immintrin.h>
+    #if defined(_MSC_VER) && !defined(__clang__)
+        #include <intrin.h>
+        #define GMATH_TARGET_AVX
+    #else
+        #define GMATH_TARGET_AVX __attribute__((target("avx")))
+    #endif
+#else
+    #define GMATH_SSE 0
+#endif
+
+namespace gmath::simd {
+
+    /**
+     * @brief Поддерживает ли процессор (и ОС) AVX. Проверяется один раз
+     */
+    inline bool has_avx() {
+#if GMATH_SSE
+    #if defined(_MSC_VER) && !defined(__clang__)
+        static const bool supported = [] {
+            int info[4];
+            __cpuid(info, 1);
+            const bool osxsave = (info[2] & (1 << 27)) != 0;
+            const bool avx = (info[2] & (1 << 28)) != 0;
+            return osxsave && avx && (_xgetbv(0) & 0x6) == 0x6;
+        }();
+    #else
+        static const bool supported = __builtin_cpu_supports("avx");
+    #endif
+        return supported;
+#else
+        return false;
+#endif
+    }
+}
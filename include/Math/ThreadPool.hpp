@@ -0,0 +1,174 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace gmath {
+
+    /**
+     * @brief Пул потоков с одной операцией — parallel_for
+     *
+     * Вызывающий поток тоже выполняет задачи, поэтому пул из N рабочих
+     * загружает N + 1 ядро
+     */
+    class ThreadPool {
+        public:
+            /**
+             * @param workers Число рабочих потоков, по умолчанию hardware_concurrency() - 1
+             */
+            explicit ThreadPool(std::size_t workers = default_worker_count()) {
+                m_workers.reserve(workers);
+                for (std::size_t i = 0; i < workers; ++i) {
+                    m_workers.emplace_back([this] { worker_loop(); });
+                }
+            }
+
+            ~ThreadPool() {
+                {
+                    std::lock_guard lock(m_mutex);
+                    m_stop = true;
+                }
+                m_wake.notify_all();
+                for (auto& worker : m_workers) {
+                    worker.join();
+                }
+            }
+
+            ThreadPool(const ThreadPool&) = delete;
+            ThreadPool& operator=(const ThreadPool&) = delete;
+
+            /**
+             * @brief Выполняет task(i) для i в [0, count) и ждёт завершения всех задач
+             *
+             * Индексы раздаются по одному через атомарный счётчик, так что
+             * неравные по стоимости задачи (тайлы) балансируются сами.
+             *
+             * Первое исключение из task останавливает раздачу индексов; после того
+             * как все потоки закончат свои задачи, оно пробрасывается вызывающему.
+             * Вызов изнутри задачи пула выполняется в текущем потоке
+             */
+            void parallel_for(std::size_t count, const std::function<void(std::size_t)>& task) {
+                if (count == 0) {
+                    return;
+                }
+                if (m_workers.empty() || count == 1 || t_inTask) {
+                    for (std::size_t i = 0; i < count; ++i) {
+                        task(i);
+                    }
+                    return;
+                }
+
+                std::lock_guard submit(m_submitMutex);
+                {
+                    std::lock_guard lock(m_mutex);
+                    m_task = &task;
+                    m_count = count;
+                    m_next.store(0, std::memory_order_relaxed);
+                    m_busy = m_workers.size();
+                    ++m_generation;
+                }
+                m_wake.notify_all();
+
+                run_tasks();
+
+                // Ждём рабочих и при исключении: они ещё обращаются к task
+                std::unique_lock lock(m_mutex);
+                m_done.wait(lock, [this] { return m_busy == 0; });
+                m_task = nullptr;
+                if (m_failure) {
+                    std::rethrow_exception(std::exchange(m_failure, nullptr));
+                }
+            }
+
+            /**
+             * @brief Потоков, участвующих в parallel_for, включая вызывающий
+             */
+            [[nodiscard]] std::size_t concurrency() const {
+                return m_workers.size() + 1;
+            }
+
+            static std::size_t default_worker_count() {
+                const unsigned hardware = std::thread::hardware_concurrency();
+                return hardware > 1 ? hardware - 1 : 0;
+            }
+
+            /**
+             * @brief Общий пул процесса для параллельных алгоритмов gmath, создаётся при первом обращении
+             */
+            static ThreadPool& shared() {
+                static ThreadPool pool;
+                return pool;
+            }
+
+        private:
+            void run_tasks() {
+                t_inTask = true;
+                try {
+                    while (true) {
+                        const std::size_t i = m_next.fetch_add(1, std::memory_order_relaxed);
+                        if (i >= m_count) {
+                            break;
+                        }
+                        (*m_task)(i);
+                    }
+                } catch (...) {
+                    // Остальные потоки доделывают начатые задачи и новых не берут
+                    m_next.store(m_count, std::memory_order_relaxed);
+                    std::lock_guard lock(m_mutex);
+                    if (!m_failure) {
+                        m_failure = std::current_exception();
+                    }
+                }
+                t_inTask = false;
+            }
+
+            void worker_loop() {
+                std::size_t seen_generation = 0;
+                while (true) {
+                    {
+                        std::unique_lock lock(m_mutex);
+                        m_wake.wait(lock, [&] { return m_stop || m_generation != seen_generation; });
+                        if (m_stop) {
+                            return;
+                        }
+                        seen_generation = m_generation;
+                    }
+
+                    run_tasks();
+
+                    {
+                        std::lock_guard lock(m_mutex);
+                        if (--m_busy == 0) {
+                            m_done.notify_one();
+                        }
+                    }
+                }
+            }
+
+            // Поток сейчас выполняет задачу какого-либо пула: вложенный parallel_for
+            // ждал бы m_submitMutex, занятый внешним вызовом
+            static inline thread_local bool t_inTask = false;
+
+            std::vector<std::thread> m_workers;
+
+            std::mutex m_submitMutex; // один parallel_for за раз
+            std::mutex m_mutex;
+            std::condition_variable m_wake;
+            std::condition_variable m_done;
+
+            const std::function<void(std::size_t)>* m_task = nullptr;
+            std::size_t m_count = 0;
+            std::atomic<std::size_t> m_next{0};
+            std::size_t m_generation = 0;
+            std::size_t m_busy = 0;
+            bool m_stop = false;
+            std::exception_ptr m_failure; // под m_mutex
+    };
+}
@@ -0,0 +1,170 @@
+#pragma once
+
+#include <cstddef>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+
+#include "MConcepts.hpp"
+#include "Matrix4.hpp"
+#include "Simd.hpp"
+#include "Vector4.hpp"
+
+namespace gmath {
+
+    /**
+     * @brief Пакетные преобразования массивов вершин матрицей 4x4
+     *
+     * Для float используются SSE (4 значения) или AVX (8 значений, если есть
+     * у процессора). Порядок сложений везде ((m0 x + m1 y) + m2 z) + m3 w,
+     * как в Matrix4 * Vector4, поэтому результат не зависит от пути
+     */
+    namespace batch {
+        namespace detail {
+            template<is_float_double T>
+            void transform_points_scalar(
+                const Matrix4<T>& matrix, const T* x, const T* y, const T* z,
+                std::size_t begin, std::size_t end, T* const out[4]
+            ) {
+                const T* m = matrix.values();
+                for (std::size_t i = begin; i < end; ++i) {
+                    for (int r = 0; r < 4; ++r) {
+                        out[r][i] = m[r * 4] * x[i] + m[r * 4 + 1] * y[i] + m[r * 4 + 2] * z[i] + m[r * 4 + 3];
+                    }
+                }
+            }
+
+#if GMATH_SSE
+            inline std::size_t transform_points_sse(
+                const Matrix4<float>& matrix, const float* x, const float* y, const float* z,
+                std::size_t count, float* const out[4]
+            ) {
+                const float* m = matrix.values();
+                std::size_t i = 0;
+                for (; i + 4 <= count; i += 4) {
+                    const __m128 vx = _mm_loadu_ps(x + i);
+                    const __m128 vy = _mm_loadu_ps(y + i);
+                    const __m128 vz = _mm_loadu_ps(z + i);
+                    for (int r = 0; r < 4; ++r) {
+                        __m128 v = _mm_mul_ps(_mm_set1_ps(m[r * 4]), vx);
+                        v = _mm_add_ps(v, _mm_mul_ps(_mm_set1_ps(m[r * 4 + 1]), vy));
+                        v = _mm_add_ps(v, _mm_mul_ps(_mm_set1_ps(m[r * 4 + 2]), vz));
+                        v = _mm_add_ps(v, _mm_set1_ps(m[r * 4 + 3]));
+                        _mm_storeu_ps(out[r] + i, v);
+                    }
+                }
+                return i;
+            }
+
+            GMATH_TARGET_AVX inline std::size_t transform_points_avx(
+                const Matrix4<float>& matrix, const float* x, const float* y, const float* z,
+                std::size_t count, float* const out[4]
+            ) {
+                const float* m = matrix.values();
+                __m256 rows[4][4];
+                for (int r = 0; r < 4; ++r) {
+                    for (int c = 0; c < 4; ++c) {
+                        rows[r][c] = _mm256_set1_ps(m[r * 4 + c]);
+                    }
+                }
+
+                std::size_t i = 0;
+                for (; i + 8 <= count; i += 8) {
+                    const __m256 vx = _mm256_loadu_ps(x + i);
+                    const __m256 vy = _mm256_loadu_ps(y + i);
+                    const __m256 vz = _mm256_loadu_ps(z + i);
+                    for (int r = 0; r < 4; ++r) {
+                        __m256 v = _mm256_mul_ps(rows[r][0], vx);
+                        v = _mm256_add_ps(v, _mm256_mul_ps(rows[r][1], vy));
+                        v = _mm256_add_ps(v, _mm256_mul_ps(rows[r][2], vz));
+                        v = _mm256_add_ps(v, rows[r][3]);
+                        _mm256_storeu_ps(out[r] + i, v);
+                    }
+                }
+                return i;
+            }
+
+            // Два Vector4 за итерацию: компоненты каждого размножаются по своей половине регистра
+            GMATH_TARGET_AVX inline std::size_t transform_avx(
+                const __m128 columns[4], const Vector4<float>* in, Vector4<float>* out, std::size_t count
+            ) {
+                const __m256 c0 = _mm256_set_m128(columns[0], columns[0]);
+                const __m256 c1 = _mm256_set_m128(columns[1], columns[1]);
+                const __m256 c2 = _mm256_set_m128(columns[2], columns[2]);
+                const __m256 c3 = _mm256_set_m128(columns[3], columns[3]);
+
+                std::size_t i = 0;
+                for (; i + 2 <= count; i += 2) {
+                    const __m256 v = _mm256_loadu_ps(&in[i].x);
+                    __m256 r = _mm256_mul_ps(c0, _mm256_permute_ps(v, 0x00));
+                    r = _mm256_add_ps(r, _mm256_mul_ps(c1, _mm256_permute_ps(v, 0x55)));
+                    r = _mm256_add_ps(r, _mm256_mul_ps(c2, _mm256_permute_ps(v, 0xAA)));
+                    r = _mm256_add_ps(r, _mm256_mul_ps(c3, _mm256_permute_ps(v, 0xFF)));
+                    _mm256_storeu_ps(&out[i].x, r);
+                }
+                return i;
+            }
+#endif
+        }
+
+        /**
+         * @brief Точки (x, y, z, 1) в SoA-потоках -> (out_x, out_y, out_z, out_w) = matrix * p
+         *
+         * Входные и выходные потоки — массивы по count элементов; out_* не должны
+         * пересекаться с входом
+         */
+        template<is_float_double T>
+        void transform_points(
+            const Matrix4<T>& matrix,
+            const T* x, const T* y, const T* z, std::size_t count,
+            T* out_x, T* out_y, T* out_z, T* out_w
+        ) {
+            T* const out[4] = {out_x, out_y, out_z, out_w};
+            std::size_t done = 0;
+#if GMATH_SSE
+            if constexpr (std::is_same_v<T, float>) {
+                done = simd::has_avx()
+                    ? detail::transform_points_avx(matrix, x, y, z, count, out)
+                    : detail::transform_points_sse(matrix, x, y, z, count, out);
+            }
+#endif
+            detail::transform_points_scalar(matrix, x, y, z, done, count, out);
+        }
+
+        /**
+         * @brief out[i] = matrix * in[i]; in и out могут совпадать
+         */
+        template<is_float_double T>
+        void transform(const Matrix4<T>& matrix, std::span<const Vector4<T>> in, std::span<Vector4<T>> out) {
+            if (out.size() < in.size()) {
+                throw std::invalid_argument("Output span is too small");
+            }
+            std::size_t i = 0;
+#if GMATH_SSE
+            if constexpr (std::is_same_v<T, float>) {
+                static_assert(sizeof(Vector4<float>) == 4 * sizeof(float));
+                const float* m = matrix.values();
+                __m128 columns[4] = {
+                    _mm_loadu_ps(m), _mm_loadu_ps(m + 4), _mm_loadu_ps(m + 8), _mm_loadu_ps(m + 12)
+                };
+                _MM_TRANSPOSE4_PS(columns[0], columns[1], columns[2], columns[3]);
+
+                if (simd::has_avx()) {
+                    i = detail::transform_avx(columns, in.data(), out.data(), in.size());
+                }
+                for (; i < in.size(); ++i) {
+                    const __m128 v = _mm_loadu_ps(&in[i].x);
+                    __m128 r = _mm_mul_ps(columns[0], _mm_shuffle_ps(v, v, 0x00));
+                    r = _mm_add_ps(r, _mm_mul_ps(columns[1], _mm_shuffle_ps(v, v, 0x55)));
+                    r = _mm_add_ps(r, _mm_mul_ps(columns[2], _mm_shuffle_ps(v, v, 0xAA)));
+                    r = _mm_add_ps(r, _mm_mul_ps(columns[3], _mm_shuffle_ps(v, v, 0xFF)));
+                    _mm_storeu_ps(&out[i].x, r);
+                }
+            }
+#endif
+            for (; i < in.size(); ++i) {
+                out[i] = matrix * in[i];
+            }
+        }
+    }
+}
@@ -7,6 +7,8 @@
 #include <stdexcept>
 #include <limits>
 
+#include "CMath.hpp"
+#include "Checks.hpp"
 #include "MConcepts.hpp"
 
 
@@ -22,64 +24,68 @@ namespace gmath {
         public:
             T x, y;
             
-            Vector2() : x(0), y(0) {}
-            Vector2(T x, T y) : x(x), y(y) {}                    
+            constexpr Vector2() : x(0), y(0) {}
+            constexpr Vector2(T x, T y) : x(x), y(y) {}                    
                         
-            Vector2 operator+(const Vector2& other) const {
+            constexpr Vector2 operator+(const Vector2& other) const noexcept {
                 return Vector2(x + other.x, y + other.y);
             }
             
-            Vector2 operator-(const Vector2& other) const {
+            constexpr Vector2 operator-(const Vector2& other) const noexcept {
                 return Vector2(x - other.x, y - other.y);
             }
             
-            Vector2 operator*(T scalar) const {
+            constexpr Vector2 operator*(T scalar) const noexcept {
                 return Vector2(x * scalar, y * scalar);
             }
             
-            Vector2 operator/(T scalar) const {
-                if (scalar == 0) {
-                    throw std::runtime_error("Division by zero");
+            constexpr Vector2 operator/(T scalar) const GMATH_NOEXCEPT {
+                if constexpr (checks_enabled) {
+                    if (scalar == T(0)) {
+                        throw std::runtime_error("Division by zero");
+                    }
                 }
                 return Vector2(x / scalar, y / scalar);
             }
                                 
-            Vector2& operator+=(const Vector2& other) {
+            constexpr Vector2& operator+=(const Vector2& other) noexcept {
                 x += other.x;
                 y += other.y;
                 return *this;
             }
             
-            Vector2& operator-=(const Vector2& other) {
+            constexpr Vector2& operator-=(const Vector2& other) noexcept {
                 x -= other.x;
                 y -= other.y;
                 return *this;
             }
             
-            Vector2& operator*=(T scalar) {
+            constexpr Vector2& operator*=(T scalar) noexcept {
                 x *= scalar;
                 y *= scalar;
                 return *this;
             }
             
-            Vector2& operator/=(T scalar) {
-                if (scalar == 0) {
-                    throw std::runtime_error("Division by zero");
+            constexpr Vector2& operator/=(T scalar) GMATH_NOEXCEPT {
+                if constexpr (checks_enabled) {
+                    if (scalar == T(0)) {
+                        throw std::runtime_error("Division by zero");
+                    }
                 }
                 x /= scalar;
                 y /= scalar;
                 return *this;
             }
                                 
-            Vector2 operator-() const {
+            constexpr Vector2 operator-() const noexcept {
                 return Vector2(-x, -y);
             }
             
-            bool operator==(const Vector2& other) const {
+            constexpr bool operator==(const Vector2& other) const {
                 return x == other.x && y == other.y;
             }
             
-            bool operator!=(const Vector2& other) const {
+            constexpr bool operator!=(const Vector2& other) const {
                 return !(*this == other);
             }
             
@@ -92,8 +98,8 @@ namespace gmath {
              * @brief Сравнение
              * @param other Второй веткор            
              */
-            bool equals(const Vector2& other, T eps = std::numeric_limits<T>::epsilon()) const {
-                return std::abs(x - other.x) < eps && std::abs(y - other.y) < eps;
+            constexpr bool equals(const Vector2& other, T eps = std::numeric_limits<T>::epsilon()) const {
+                return cmath::abs(x - other.x) < eps && cmath::abs(y - other.y) < eps;
             }
                        
             /**
@@ -101,25 +107,25 @@ namespace gmath {
              * @param other Второй вектор
              * @return Скалярное произведение - число
              */
-            [[nodiscard]] T dot(const Vector2& other) const {
+            [[nodiscard]] constexpr T dot(const Vector2& other) const noexcept {
                 return x * other.x + y * other.y;
             }
                         
-            [[nodiscard]] T length_squared() const noexcept {
+            [[nodiscard]] constexpr T length_squared() const noexcept {
                 return x * x + y * y;
             }
             
-            [[nodiscard]] T length() const noexcept {
-                return std::sqrt(length_squared());
+            [[nodiscard]] constexpr T length() const noexcept {
+                return cmath::sqrt(length_squared());
             }
             
-            [[nodiscard]] Vector2 normalized() const {
+            [[nodiscard]] constexpr Vector2 normalized() const {
                 T len = length();                
                 if (len == 0) return *this;
                 return *this / len;
             }
             
-            void normalize() {
+            constexpr void normalize() {
                 T len = length();     
                 if (len == 0) return;           
                 *this /= len;
@@ -6,6 +6,8 @@
 #include <stdexcept>
 #include <limits>
 
+#include "CMath.hpp"
+#include "Checks.hpp"
 #include "MConcepts.hpp"
 
 namespace gmath {    
@@ -20,54 +22,58 @@ namespace gmath {
         public:
             T x, y, z;
 
-            Vector3() : x(0), y(0), z(0) {}
-            Vector3(T x, T y, T z) : x(x), y(y), z(z) {}
-            Vector3(const Vector3& other) = default;          
+            constexpr Vector3() : x(0), y(0), z(0) {}
+            constexpr Vector3(T x, T y, T z) : x(x), y(y), z(z) {}
+            constexpr Vector3(const Vector3& other) = default;          
 
             
-            Vector3 operator+(const Vector3& other) const {
+            constexpr Vector3 operator+(const Vector3& other) const noexcept {
                 return Vector3(x + other.x, y + other.y, z + other.z);
             }
             
-            Vector3 operator-(const Vector3& other) const {
+            constexpr Vector3 operator-(const Vector3& other) const noexcept {
                 return Vector3(x - other.x, y - other.y, z - other.z);
             }
             
-            Vector3 operator*(T scalar) const {
+            constexpr Vector3 operator*(T scalar) const noexcept {
                 return Vector3(x * scalar, y * scalar, z * scalar);
             }
             
-            Vector3 operator/(T scalar) const {
-                if (scalar == 0) {
-                    throw std::runtime_error("Division by zero");
+            constexpr Vector3 operator/(T scalar) const GMATH_NOEXCEPT {
+                if constexpr (checks_enabled) {
+                    if (scalar == T(0)) {
+                        throw std::runtime_error("Division by zero");
+                    }
                 }
                 return Vector3(x / scalar, y / scalar, z / scalar);
             }
                     
-            Vector3& operator+=(const Vector3& other) {
+            constexpr Vector3& operator+=(const Vector3& other) noexcept {
                 x += other.x;
                 y += other.y;
                 z += other.z;
                 return *this;
             }
             
-            Vector3& operator-=(const Vector3& other) {
+            constexpr Vector3& operator-=(const Vector3& other) noexcept {
                 x -= other.x;
                 y -= other.y;
                 z -= other.z;
                 return *this;
             }
             
-            Vector3& operator*=(T scalar) {
+            constexpr Vector3& operator*=(T scalar) noexcept {
                 x *= scalar;
                 y *= scalar;
                 z *= scalar;
                 return *this;
             }
             
-            Vector3& operator/=(T scalar) {
-                if (scalar == 0) {
-                    throw std::runtime_error("Division by zero");
+            constexpr Vector3& operator/=(T scalar) GMATH_NOEXCEPT {
+                if constexpr (checks_enabled) {
+                    if (scalar == T(0)) {
+                        throw std::runtime_error("Division by zero");
+                    }
                 }
                 x /= scalar;
                 y /= scalar;
@@ -75,15 +81,15 @@ namespace gmath {
                 return *this;
             }
                     
-            Vector3 operator-() const {
+            constexpr Vector3 operator-() const noexcept {
                 return Vector3(-x, -y, -z);
             }
 
-            bool operator==(const Vector3& other) const {
+            constexpr bool operator==(const Vector3& other) const {
                 return x == other.x && y == other.y && z == other.z;
             }
             
-            bool operator!=(const Vector3& other) const {
+            constexpr bool operator!=(const Vector3& other) const {
                 return !(*this == other);
             }
 
@@ -92,7 +98,7 @@ namespace gmath {
                 return os;
             }
 
-            [[nodiscard]] T dot(const Vector3& other) const {
+            [[nodiscard]] constexpr T dot(const Vector3& other) const noexcept {
                 return x * other.x + y * other.y + z * other.z;
             }
 
@@ -100,8 +106,8 @@ namespace gmath {
              * @brief Сравнение
              * @param other Второй веткор            
              */
-            bool equals(const Vector3& other, T eps = std::numeric_limits<T>::epsilon()) const {
-                return std::abs(x - other.x) < eps && std::abs(y - other.y) < eps && std::abs(z - other.z) < eps;
+            constexpr bool equals(const Vector3& other, T eps = std::numeric_limits<T>::epsilon()) const {
+                return cmath::abs(x - other.x) < eps && cmath::abs(y - other.y) < eps && cmath::abs(z - other.z) < eps;
             }
             
             /**
@@ -109,7 +115,7 @@ namespace gmath {
              * @param other Второй вектор
              * @return Векторное произведение - новый векор
              */
-            [[nodiscard]] Vector3 cross(const Vector3& other) const {
+            [[nodiscard]] constexpr Vector3 cross(const Vector3& other) const noexcept {
                 return Vector3(
                     y * other.z - z * other.y,
                     z * other.x - x * other.z,
@@ -117,27 +123,27 @@ namespace gmath {
                 );
             }
             
-            [[nodiscard]] T length_squared() const noexcept {
+            [[nodiscard]] constexpr T length_squared() const noexcept {
                 return x * x + y * y + z * z;
             }
             
-            [[nodiscard]] T length() const noexcept {
-                return std::sqrt(length_squared());
+            [[nodiscard]] constexpr T length() const noexcept {
+                return cmath::sqrt(length_squared());
             }
             
-            [[nodiscard]] Vector3 normalized() const {
+            [[nodiscard]] constexpr Vector3 normalized() const {
                 T len = length();
                 if (len == 0) return *this;
                 return *this / len;
             }
             
-            void normalize() {
+            constexpr void normalize() {
                 T len = length();
                 if (len == 0) return;           
                 *this /= len;
             }
 
-            static Vector3 Null() {
+            static constexpr Vector3 Null() {
                     return Vector3(0, 0, 0);
                 }
 
@@ -5,9 +5,12 @@
 #include <ostream>
 #include <stdexcept>
 #include <limits>
-//#include <emmintrin.h>
+#include <type_traits>
 
+#include "CMath.hpp"
+#include "Checks.hpp"
 #include "MConcepts.hpp"
+#include "Simd.hpp"
 
 namespace gmath {    
 
@@ -21,29 +24,31 @@ namespace gmath {
         public:
             T x, y, z, w;            
             
-            Vector4() : x(0), y(0), z(0), w(0) {}
-            Vector4(T x, T y, T z, T w) : x(x), y(y), z(z), w(w) {}                                                         
+            constexpr Vector4() : x(0), y(0), z(0), w(0) {}
+            constexpr Vector4(T x, T y, T z, T w) : x(x), y(y), z(z), w(w) {}                                                         
                         
-            Vector4 operator+(const Vector4& other) const {
+            constexpr Vector4 operator+(const Vector4& other) const noexcept {
                 return Vector4(x + other.x, y + other.y, z + other.z, w + other.w);
             }
             
-            Vector4 operator-(const Vector4& other) const {
+            constexpr Vector4 operator-(const Vector4& other) const noexcept {
                 return Vector4(x - other.x, y - other.y, z - other.z, w - other.w);
             }
             
-            Vector4 operator*(T scalar) const {
+            constexpr Vector4 operator*(T scalar) const noexcept {
                 return Vector4(x * scalar, y * scalar, z * scalar, w * scalar);
             }
             
-            Vector4 operator/(T scalar) const {
-                if (scalar == 0) {
-                    throw std::runtime_error("Division by zero");
+            constexpr Vector4 operator/(T scalar) const GMATH_NOEXCEPT {
+                if constexpr (checks_enabled) {
+                    if (scalar == T(0)) {
+                        throw std::runtime_error("Division by zero");
+                    }
                 }
                 return Vector4(x / scalar, y / scalar, z / scalar, w / scalar);
             }
                                 
-            Vector4& operator+=(const Vector4& other) {
+            constexpr Vector4& operator+=(const Vector4& other) noexcept {
                 x += other.x;
                 y += other.y;
                 z += other.z;
@@ -51,7 +56,7 @@ namespace gmath {
                 return *this;
             }
             
-            Vector4& operator-=(const Vector4& other) {
+            constexpr Vector4& operator-=(const Vector4& other) noexcept {
                 x -= other.x;
                 y -= other.y;
                 z -= other.z;
@@ -59,7 +64,7 @@ namespace gmath {
                 return *this;
             }
                                     
-            Vector4& operator*=(T scalar) {
+            constexpr Vector4& operator*=(T scalar) noexcept {
                 x *= scalar;
                 y *= scalar;
                 z *= scalar;
@@ -67,9 +72,11 @@ namespace gmath {
                 return *this;
             }
             
-            Vector4& operator/=(T scalar) {
-                if (scalar == 0) {
-                    throw std::runtime_error("Division by zero");
+            constexpr Vector4& operator/=(T scalar) GMATH_NOEXCEPT {
+                if constexpr (checks_enabled) {
+                    if (scalar == T(0)) {
+                        throw std::runtime_error("Division by zero");
+                    }
                 }
                 x /= scalar;
                 y /= scalar;
@@ -78,15 +85,15 @@ namespace gmath {
                 return *this;
             }
                                 
-            Vector4 operator-() const {
+            constexpr Vector4 operator-() const noexcept {
                 return Vector4(-x, -y, -z, -w);
             }
             
-            bool operator==(const Vector4& other) const {
+            constexpr bool operator==(const Vector4& other) const {
                 return x == other.x && y == other.y && z == other.z && w == other.w;
             }
             
-            bool operator!=(const Vector4& other) const {
+            constexpr bool operator!=(const Vector4& other) const {
                 return !(*this == other);
             }
             
@@ -99,33 +106,76 @@ namespace gmath {
              * @brief Сравнение
              * @param other Второй веткор            
              */
-            bool equals(const Vector4& other, T eps = std::numeric_limits<T>::epsilon()) const {
-                return std::abs(x - other.x) < eps && std::abs(y - other.y) < eps && std::abs(z - other.z) < eps && std::abs(w - other.w) < eps;
+            constexpr bool equals(const Vector4& other, T eps = std::numeric_limits<T>::epsilon()) const {
+                return cmath::abs(x - other.x) < eps && cmath::abs(y - other.y) < eps && cmath::abs(z - other.z) < eps && cmath::abs(w - other.w) < eps;
             }
             
-            [[nodiscard]] T dot(const Vector4& other) const {
+            [[nodiscard]] constexpr T dot(const Vector4& other) const noexcept {
+#if GMATH_SSE
+                if constexpr (std::is_same_v<T, float>) {
+                    if (!std::is_constant_evaluated()) {
+                        return simd_dot(load(), other.load());
+                    }
+                }
+#endif
                 return x * other.x + y * other.y + z * other.z + w * other.w;
             }            
                         
-            [[nodiscard]] T length_squared() const noexcept {
+            [[nodiscard]] constexpr T length_squared() const noexcept {
+#if GMATH_SSE
+                if constexpr (std::is_same_v<T, float>) {
+                    if (!std::is_constant_evaluated()) {
+                        const __m128 v = load();
+                        return simd_dot(v, v);
+                    }
+                }
+#endif
                 return x * x + y * y + z * z + w * w;
             }
             
-            [[nodiscard]] T length() const noexcept {
-                return std::sqrt(length_squared());
+            [[nodiscard]] constexpr T length() const noexcept {
+                return cmath::sqrt(length_squared());
             }
             
-            [[nodiscard]] Vector4 normalized() const {
+            [[nodiscard]] constexpr Vector4 normalized() const {
+#if GMATH_SSE
+                if constexpr (std::is_same_v<T, float>) {
+                    if (!std::is_constant_evaluated()) {
+                        // Вектор 4 float целиком в одном регистре: длина и деление без распаковки
+                        const __m128 v = load();
+                        const __m128 len = _mm_sqrt_ps(_mm_set1_ps(simd_dot(v, v)));
+                        if (_mm_cvtss_f32(len) == 0.0f) return *this;
+                        Vector4 result;
+                        _mm_storeu_ps(&result.x, _mm_div_ps(v, len));
+                        return result;
+                    }
+                }
+#endif
                 T len = length();                
                 if (len == 0) return *this;
                 return *this / len;
             }
             
-            void normalize() {
+            constexpr void normalize() {
                 T len = length();                
                 if (len == 0) return;           
                 *this /= len;
             }            
+
+#if GMATH_SSE
+        private:
+            [[nodiscard]] __m128 load() const noexcept {
+                static_assert(sizeof(Vector4) == 4 * sizeof(T));
+                return _mm_loadu_ps(&x);
+            }
+
+            // (x + y) + (z + w) для произведения по компонентам
+            static float simd_dot(__m128 a, __m128 b) noexcept {
+                const __m128 m = _mm_mul_ps(a, b);
+                const __m128 pairs = _mm_add_ps(m, _mm_shuffle_ps(m, m, _MM_SHUFFLE(2, 3, 0, 1)));
+                return _mm_cvtss_f32(_mm_add_ss(pairs, _mm_movehl_ps(pairs, pairs)));
+            }
+#endif
     };
 
     using Vector4f = Vector4<float>;
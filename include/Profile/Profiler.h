@@ -0,0 +1,213 @@
+//
+// Created by shulz on 18.12.2025.
+//
+
+#ifndef KGG_CPP_PROJECT_REPO_PROFILER_H
+#define KGG_CPP_PROJECT_REPO_PROFILER_H
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <vector>
+
+/**
+ * KGG_PROFILE = 0 убирает замеры из сборки: KGG_PROFILE_SCOPE и KGG_PROFILE_COUNT
+ * раскрываются в пустоту. По умолчанию замеры собраны, но выключены
+ * (Profiler::set_enabled) — тогда цена замера — одно relaxed-чтение флага
+ */
+#ifndef KGG_PROFILE
+    #define KGG_PROFILE 1
+#endif
+
+namespace profile {
+    /**
+     * Этапы кадра. Этап на потоке пула (tile) складывается по всем потокам,
+     * остальные замеряются на вызывающем потоке и дают время «по часам»
+     */
+    enum class Stage : std::uint8_t {
+        frame,     // кадр целиком на потоке рендера
+        clear,     // Framebuffer::clear / clear_depth
+        transform, // VertexStage, вершинный шейдер
+        binning,   // TriangleSetup и раскладка по тайлам
+        raster,    // растеризация всех тайлов, от запуска до последнего
+        tile,      // один тайл на потоке пула
+        upload,    // загрузка кадра в текстуру
+        COUNT
+    };
+
+    enum class Counter : std::uint8_t {
+        triangles_submitted,  // дошли до TriangleSetup или отброшены Clipper
+        triangles_culled,     // вырожденные, задом, вне экрана, отсечены целиком
+        triangles_rasterized, // переданы в растеризацию
+        pixels_shaded,        // записано пикселей цвета
+        COUNT
+    };
+
+    inline constexpr std::size_t STAGE_COUNT = static_cast<std::size_t>(Stage::COUNT);
+    inline constexpr std::size_t COUNTER_COUNT = static_cast<std::size_t>(Counter::COUNT);
+
+    [[nodiscard]] const char* name(Stage stage);
+    [[nodiscard]] const char* name(Counter counter);
+
+    struct Event {
+        std::int64_t start_ns;    // Profiler::now_ns()
+        std::int64_t duration_ns;
+        std::uint32_t thread;     // номер потока в Profiler, не id ОС
+        Stage stage;
+    };
+
+    /**
+     * Кольцо событий одного потока (SPSC): push вызывает только поток-владелец,
+     * pop — только сборщик (Profiler::collect). Без блокировок: у каждой
+     * стороны свой индекс, второй читается с acquire.
+     * Переполненное кольцо не ждёт сборщика — событие отбрасывается и считается
+     */
+    class EventRing {
+        public:
+            static constexpr std::size_t CAPACITY = 4096; // степень двойки
+
+            bool push(const Event& event);
+            bool pop(Event& event);
+
+            [[nodiscard]] std::uint64_t dropped() const { return m_dropped.load(std::memory_order_relaxed); }
+
+        private:
+            std::array<Event, CAPACITY> m_events{};
+            alignas(64) std::atomic<std::size_t> m_head{0}; // пишет владелец
+            alignas(64) std::atomic<std::size_t> m_tail{0}; // пишет сборщик
+            std::atomic<std::uint64_t> m_dropped{0};
+    };
+
+    // Итог одного collect: время этапов и приращение счётчиков
+    struct FrameStats {
+        std::array<double, STAGE_COUNT> stage_ms{};
+        std::array<std::uint64_t, COUNTER_COUNT> counters{};
+    };
+
+    /**
+     * Сбор замеров со всех потоков
+     *
+     * - горячий путь (любой поток): record / count пишут в данные своего потока —
+     *   кольцо событий и счётчики с единственным писателем; общих блокировок нет,
+     *   мьютекс берётся один раз, когда поток пишет впервые
+     * - сборщик (один поток, обычно UI): collect раз в кадр забирает события всех
+     *   колец и приращения счётчиков, складывает в историю для графиков и,
+     *   если идёт запись, в трассу для chrome://tracing / Perfetto
+     */
+    class Profiler {
+        public:
+            static constexpr std::size_t HISTORY = 240;          // кадров в истории
+            static constexpr std::size_t MAX_CAPTURE = 1 << 20;  // событий в трассе
+
+            static Profiler& instance();
+
+            void set_enabled(bool enabled);
+            [[nodiscard]] bool enabled() const { return m_enabled.load(std::memory_order_relaxed); }
+
+            // ---------- Горячий путь ----------
+
+            void record(Stage stage, std::int64_t start_ns, std::int64_t end_ns);
+            void count(Counter counter, std::uint64_t value);
+
+            // ---------- Сборщик ----------
+
+            FrameStats collect();
+
+            // Значения этапа / счётчика по кадрам истории, от старых к новым
+            void stage_history(Stage stage, std::vector<float>& out) const;
+            void counter_history(Counter counter, std::vector<float>& out) const;
+            [[nodiscard]] const FrameStats& last() const;
+
+            void start_capture();
+            void stop_capture();
+            [[nodiscard]] bool capturing() const { return m_capturing; }
+            [[nodiscard]] std::size_t captured_events() const { return m_capture.size(); }
+
+            /**
+             * Записанная трасса в формате Chrome Trace Event: этапы — события "X"
+             * на дорожках потоков, счётчики — события "C" на каждый collect
+             */
+            void write_chrome_trace(std::ostream& out) const;
+            // Бросает std::runtime_error, если файл не записывается
+            void write_chrome_trace(const std::string& path) const;
+
+            // Событий, отброшенных переполненными кольцами
+            [[nodiscard]] std::uint64_t dropped_events() const;
+
+            static std::int64_t now_ns();
+
+        private:
+            struct ThreadState;
+            struct CounterSample {
+                std::int64_t time_ns;
+                std::array<std::uint64_t, COUNTER_COUNT> counters;
+            };
+
+            Profiler() = default;
+            ThreadState& local();
+
+            std::atomic<bool> m_enabled{false};
+
+            mutable std::mutex m_registryMutex; // регистрация потоков и collect
+            std::vector<std::unique_ptr<ThreadState>> m_threads;
+
+            // Только сборщик
+            std::vector<FrameStats> m_history;
+            std::size_t m_historyNext = 0;
+            FrameStats m_last{};
+            bool m_capturing = false;
+            std::vector<Event> m_capture;
+            std::vector<CounterSample> m_captureCounters;
+    };
+
+    /**
+     * Замер этапа от создания до конца области видимости
+     */
+    class ScopedTimer {
+        public:
+            explicit ScopedTimer(Stage stage)
+                : m_stage(stage),
+                  m_start(Profiler::instance().enabled() ? Profiler::now_ns() : -1)
+            {}
+
+            ~ScopedTimer() {
+                if (m_start >= 0) {
+                    Profiler::instance().record(m_stage, m_start, Profiler::now_ns());
+                }
+            }
+
+            ScopedTimer(const ScopedTimer&) = delete;
+            ScopedTimer& operator=(const ScopedTimer&) = delete;
+
+        private:
+            Stage m_stage;
+            std::int64_t m_start;
+    };
+
+    inline void count(Counter counter, std::uint64_t value) {
+        Profiler& profiler = Profiler::instance();
+        if (value != 0 && profiler.enabled()) {
+            profiler.count(counter, value);
+        }
+    }
+}
+
+#define KGG_PROFILE_CONCAT_IMPL(a, b) a##b
+#define KGG_PROFILE_CONCAT(a, b) KGG_PROFILE_CONCAT_IMPL(a, b)
+
+#if KGG_PROFILE
+    #define KGG_PROFILE_SCOPE(stage) \
+        const ::profile::ScopedTimer KGG_PROFILE_CONCAT(kgg_profile_scope_, __LINE__)(::profile::Stage::stage)
+    #define KGG_PROFILE_COUNT(counter, value) \
+        ::profile::count(::profile::Counter::counter, static_cast<std::uint64_t>(value))
+#else
+    #define KGG_PROFILE_SCOPE(stage) static_cast<void>(0)
+    #define KGG_PROFILE_COUNT(counter, value) static_cast<void>(0)
+#endif
+
+#endif //KGG_CPP_PROJECT_REPO_PROFILER_H
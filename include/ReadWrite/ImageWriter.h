@@ -0,0 +1,40 @@
+//
+// Created by lunarimoonlin on 12/14/25.
+//
+
+#ifndef KGG_CPP_PROJECT_REPO_IMAGEWRITER_H
+#define KGG_CPP_PROJECT_REPO_IMAGEWRITER_H
+
+#include <ostream>
+#include <string>
+
+namespace render {
+    class Framebuffer;
+}
+
+namespace io {
+    /**
+     * Запись кадров без внешних библиотек
+     *
+     * - ppm: P6, RGB без альфы
+     * - png: RGBA 8 бит; deflate без сжатия (stored-блоки) — запись почти
+     *   не дороже memcpy, файл читается любым просмотрщиком
+     * - raw: байты RGBA строка за строкой, без заголовка; кадры пишутся подряд
+     *   (ffmpeg -f rawvideo -pix_fmt rgba -s WxH -i ...)
+     */
+    enum class ImageFormat { ppm, png, raw };
+
+    // По расширению пути: .ppm, .png, иначе raw
+    ImageFormat format_for_path(const std::string& path);
+
+    void write_ppm(std::ostream& out, const render::Framebuffer& frame);
+    void write_png(std::ostream& out, const render::Framebuffer& frame);
+    void write_raw(std::ostream& out, const render::Framebuffer& frame);
+
+    void write_image(std::ostream& out, const render::Framebuffer& frame, ImageFormat format);
+
+    // Бросает std::runtime_error, если файл не записывается
+    void write_image(const std::string& path, const render::Framebuffer& frame);
+}
+
+#endif //KGG_CPP_PROJECT_REPO_IMAGEWRITER_H
@@ -0,0 +1,44 @@
+//
+// Created by lunarimoonlin on 12/14/25.
+//
+
+#ifndef KGG_CPP_PROJECT_REPO_MAPPEDFILE_H
+#define KGG_CPP_PROJECT_REPO_MAPPEDFILE_H
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+namespace io {
+    /**
+     * Файл, отображённый в память только для чтения (mmap / MapViewOfFile).
+     * Данные не копируются: страницы подгружаются ОС при обращении
+     */
+    class MappedFile {
+        public:
+            // Бросает std::runtime_error, если файл не открывается
+            explicit MappedFile(const std::string& path);
+            ~MappedFile();
+
+            MappedFile(MappedFile&& other) noexcept;
+            MappedFile& operator=(MappedFile&& other) noexcept;
+            MappedFile(const MappedFile&) = delete;
+            MappedFile& operator=(const MappedFile&) = delete;
+
+            [[nodiscard]] const char* data() const { return m_data; }
+            [[nodiscard]] std::size_t size() const { return m_size; }
+            [[nodiscard]] std::string_view view() const { return {m_data, m_size}; }
+
+        private:
+            void release();
+
+            const char* m_data = nullptr;
+            std::size_t m_size = 0;
+#ifdef _WIN32
+            void* m_file = nullptr;
+            void* m_mapping = nullptr;
+#endif
+    };
+}
+
+#endif //KGG_CPP_PROJECT_REPO_MAPPEDFILE_H
@@ -0,0 +1,111 @@
+//
+// Created by lunarimoonlin on 12/14/25.
+//
+
+#ifndef KGG_CPP_PROJECT_REPO_MESHCACHE_H
+#define KGG_CPP_PROJECT_REPO_MESHCACHE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <string>
+#include <vector>
+
+#include "Math/Vector2.hpp"
+#include "Math/Vector3.hpp"
+#include "ReadWrite/MappedFile.h"
+#include "ReadWrite/Reader.h"
+
+namespace io {
+    /**
+     * Заголовок файла кэша. Все секции выровнены на 16 байт,
+     * числа хранятся в порядке байт машины, записавшей файл (little-endian на x86/ARM)
+     */
+    struct MeshCacheHeader {
+        char magic[4];                 // "KGGM"
+        std::uint32_t version;
+        std::uint64_t source_size;     // размер и время изменения OBJ:
+        std::int64_t source_mtime;     // по ним проверяется, не устарел ли кэш
+        std::uint32_t vertex_count;
+        std::uint32_t index_count;
+        std::uint32_t face_count;
+        std::uint32_t texcoord_count;  // 0 или vertex_count
+        float bounds_min[3];
+        float bounds_max[3];
+        std::uint64_t positions_offset; // vertex_count * Vector3f
+        std::uint64_t normals_offset;   // vertex_count * Vector3f, нормали вершин
+        std::uint64_t texcoords_offset; // texcoord_count * Vector2f
+        std::uint64_t indices_offset;   // index_count * uint32, индексы вершин
+        std::uint64_t faces_offset;     // (face_count + 1) * uint32, начала граней в indices
+    };
+
+    /**
+     * Бинарный кэш меша рядом с OBJ (model.obj -> model.obj.kggmesh)
+     *
+     * Загрузка — отображение файла в память: массивы читаются прямо из страниц
+     * файла, без разбора и копирования. Первый load() разбирает OBJ, сводит его
+     * к вершинам Mesh (ObjData::indexed) и записывает кэш; следующие только отображают его
+     */
+    class MeshCache {
+        public:
+            // 2: грани и вершины упорядочены optimizer::optimize
+            // 3: вершины ObjData::indexed — с текстурными координатами и нормалями OBJ
+            static constexpr std::uint32_t VERSION = 3;
+
+            /**
+             * Загрузить модель через кэш; кэш пересоздаётся, если его нет,
+             * он другой версии или OBJ изменился. Если записать кэш не удалось,
+             * данные остаются в памяти
+             *
+             * @throws std::runtime_error если OBJ не читается
+             */
+            static MeshCache load(const std::string& obj_path);
+
+            /**
+             * Открыть готовый кэш
+             *
+             * @throws std::runtime_error если файл не открывается или повреждён
+             */
+            static MeshCache open(const std::string& cache_path);
+
+            /**
+             * Собрать кэш из OBJ в память: порядок граней и вершин оптимизируется
+             * для кэша (optimizer::optimize), затем хранятся вершины obj.indexed()
+             */
+            static MeshCache build(ObjData obj);
+
+            // Записать образ кэша; запись идёт во временный файл + rename
+            void save(const std::string& cache_path) const;
+
+            static std::string cache_path_for(const std::string& obj_path);
+
+            [[nodiscard]] const MeshCacheHeader& header() const;
+            [[nodiscard]] bool is_mapped() const { return m_file.has_value(); }
+
+            [[nodiscard]] std::span<const gmath::Vector3f> positions() const;
+            [[nodiscard]] std::span<const gmath::Vector3f> normals() const;
+            [[nodiscard]] std::span<const gmath::Vector2f> texcoords() const; // пусто, если их нет
+            [[nodiscard]] std::span<const std::uint32_t> indices() const;
+            [[nodiscard]] std::span<const std::uint32_t> face_offsets() const;
+
+            [[nodiscard]] std::size_t vertex_count() const { return header().vertex_count; }
+            [[nodiscard]] std::size_t face_count() const { return header().face_count; }
+
+            [[nodiscard]] gmath::Vector3f bounds_min() const;
+            [[nodiscard]] gmath::Vector3f bounds_max() const;
+
+        private:
+            MeshCache() = default;
+
+            [[nodiscard]] const char* data() const;
+            [[nodiscard]] std::size_t size() const;
+
+            // Ровно одно из двух: отображённый файл или образ в памяти
+            std::optional<MappedFile> m_file;
+            std::vector<std::uint64_t> m_image; // uint64 — для выравнивания секций
+            std::size_t m_imageSize = 0;
+    };
+}
+
+#endif //KGG_CPP_PROJECT_REPO_MESHCACHE_H
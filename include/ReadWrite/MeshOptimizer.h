@@ -0,0 +1,60 @@
+//
+// Created by lunarimoonlin on 12/14/25.
+//
+
+#ifndef KGG_CPP_PROJECT_REPO_MESHOPTIMIZER_H
+#define KGG_CPP_PROJECT_REPO_MESHOPTIMIZER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace io {
+    struct ObjData;
+
+    /**
+     * Офлайн-перестановка индексов для локальности вершин
+     *
+     * Грани заданы как в ObjData: грань i — indices[face_offsets[i] .. face_offsets[i + 1])
+     */
+    namespace optimizer {
+        // Размер моделируемого FIFO-кэша вершин
+        constexpr std::size_t DEFAULT_CACHE_SIZE = 16;
+
+        /**
+         * Порядок граней по алгоритму Tipsify (Sander, Nehab, Barczak 2007):
+         * грани выдаются веерами вокруг вершин, следующая вершина веера выбирается
+         * так, чтобы её соседи ещё были в кэше. Линейное время
+         *
+         * @return order[k] — индекс исходной грани, которая встаёт на место k
+         */
+        std::vector<std::uint32_t> tipsify(
+            std::span<const std::uint32_t> indices,
+            std::span<const std::uint32_t> face_offsets,
+            std::size_t vertex_count,
+            std::size_t cache_size = DEFAULT_CACHE_SIZE
+        );
+
+        /**
+         * Нумерация вершин в порядке первого использования: соседние в индексах
+         * вершины оказываются рядом в памяти. remap[old] = new;
+         * неиспользуемые вершины идут в конец в исходном порядке
+         */
+        std::vector<std::uint32_t> first_use_order(std::span<const std::uint32_t> indices, std::size_t vertex_count);
+
+        /**
+         * Среднее число промахов FIFO-кэша на треугольник (ACMR) для списка треугольников.
+         * Меньше — лучше; у замкнутых мешей предел около 0.5
+         */
+        float average_cache_miss_ratio(std::span<const std::uint32_t> triangles, std::size_t cache_size = DEFAULT_CACHE_SIZE);
+
+        /**
+         * Переставить грани (tipsify) и позиции (first_use_order) в ObjData.
+         * Текстурные координаты и нормали остаются на месте, их индексы переставляются вместе с гранями
+         */
+        void optimize(ObjData& obj, std::size_t cache_size = DEFAULT_CACHE_SIZE);
+    }
+}
+
+#endif //KGG_CPP_PROJECT_REPO_MESHOPTIMIZER_H
@@ -0,0 +1,80 @@
+//
+// Created by lunarimoonlin on 12/14/25.
+//
+
+#ifndef KGG_CPP_PROJECT_REPO_READER_H
+#define KGG_CPP_PROJECT_REPO_READER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "Math/Vector2.hpp"
+#include "Math/Vector3.hpp"
+
+namespace io {
+    /**
+     * Вершины с одним индексом на угол грани (ObjData::indexed) — то, что хранят Mesh и кэш меша
+     */
+    struct IndexedMesh {
+        std::vector<gmath::Vector3f> positions;
+        std::vector<gmath::Vector3f> normals;   // по одной на вершину, всегда заполнены
+        std::vector<gmath::Vector2f> texcoords; // пусто, если vt нет ни у одного угла
+        std::vector<std::uint32_t> indices;
+        std::vector<std::uint32_t> face_offsets{0};
+    };
+
+    /**
+     * Содержимое OBJ-файла в плоских массивах
+     *
+     * Грань i — это элементы [face_offsets[i], face_offsets[i + 1]) массивов
+     * *_indices. Индексы 0-based, отрицательные (относительные) индексы OBJ
+     * уже разрешены. Если у вершины грани нет vt / vn, там стоит NO_INDEX
+     */
+    struct ObjData {
+        static constexpr std::uint32_t NO_INDEX = std::numeric_limits<std::uint32_t>::max();
+
+        std::vector<gmath::Vector3f> positions;
+        std::vector<gmath::Vector2f> texcoords;
+        std::vector<gmath::Vector3f> normals;
+
+        std::vector<std::uint32_t> position_indices;
+        std::vector<std::uint32_t> texcoord_indices;
+        std::vector<std::uint32_t> normal_indices;
+        std::vector<std::uint32_t> face_offsets{0};
+
+        [[nodiscard]] std::size_t face_count() const {
+            return face_offsets.size() - 1;
+        }
+
+        // Грани в формате gmath::Normal::compute_face_normals
+        [[nodiscard]] std::vector<std::vector<int>> polygons() const;
+
+        /**
+         * Углы с разными наборами (v, vt, vn) становятся разными вершинами, грани не меняются.
+         * Текстурные координаты есть, если vt задан хоть у одного угла; углы без vt
+         * получают (0, 0). Нормали берутся из OBJ, только если vn задан у всех углов,
+         * иначе считаются по граням (NormalWeighting::angle — не зависят от триангуляции)
+         */
+        [[nodiscard]] IndexedMesh indexed() const;
+    };
+
+    class Reader {
+        public:
+            /**
+             * Чтение OBJ: файл отображается в память, строки разбираются без iostream.
+             * Большие файлы делятся на куски по границам строк и разбираются параллельно
+             *
+             * @param threads число потоков, 0 — hardware_concurrency()
+             * @throws std::runtime_error если файл не открывается или индекс вне диапазона
+             */
+            static ObjData read_obj(const std::string& path, std::size_t threads = 0);
+
+            static ObjData parse_obj(std::string_view text, std::size_t threads = 1);
+    };
+}
+
+#endif //KGG_CPP_PROJECT_REPO_READER_H
@@ -0,0 +1,94 @@
+//
+// Created by shulz on 18.12.2025.
+//
+
+#ifndef KGG_CPP_PROJECT_REPO_CLIPPER_H
+#define KGG_CPP_PROJECT_REPO_CLIPPER_H
+
+#include <array>
+#include <cstdint>
+
+#include "Math/Vector3.hpp"
+#include "Math/Vector4.hpp"
+#include "Render/Rect.h"
+
+namespace render {
+    /**
+     * Область экрана, в которую отображается NDC [-1, 1]^2.
+     * y в NDC направлен вверх, на экране — вниз
+     */
+    struct Viewport {
+        float x = 0.0f, y = 0.0f;
+        float width = 0.0f, height = 0.0f;
+
+        // Пиксели viewport — scissor для растеризатора
+        [[nodiscard]] Rect rect() const;
+    };
+
+    /**
+     * Вершина после отсечения и перехода в экранные координаты
+     */
+    struct ScreenVertex {
+        gmath::Vector3<float> position; // x, y в пикселях, z — глубина в [0, 1]
+        float inv_w;                    // 1 / w, для перспективно-корректной интерполяции
+        // Веса исходных вершин a, b, c: атрибуты новой вершины = сумма весов * атрибуты
+        gmath::Vector3<float> barycentric;
+    };
+
+    /**
+     * Отсечение треугольников в однородных координатах (clip space, как gl_Position)
+     *
+     * - near (z >= -w) и far (z <= w) отсекаются всегда
+     * - по x, y работает guard band: пока вершины внутри |x|, |y| <= guard_band * w,
+     *   треугольник не режется, лишнее отбрасывает растеризатор обрезкой
+     *   bounding box по viewport. Режутся только треугольники, вылезающие за guard band
+     * - треугольники целиком за одной из плоскостей viewport отбрасываются сразу
+     */
+    class Clipper {
+        public:
+            // Треугольник + по вершине на каждую из 6 плоскостей
+            static constexpr int MAX_VERTICES = 9;
+
+            struct Polygon {
+                std::array<ScreenVertex, MAX_VERTICES> vertices;
+                int count = 0;
+
+                // Треугольники веером (0, i, i + 1)
+                [[nodiscard]] int triangle_count() const {
+                    return count >= 3 ? count - 2 : 0;
+                }
+            };
+
+            /**
+             * @param guard_band половина ширины guard band в единицах NDC (1 — сам viewport)
+             */
+            explicit Clipper(const Viewport& viewport, float guard_band = 4.0f);
+
+            /**
+             * @return Выпуклый многоугольник в экранных координатах; count == 0,
+             *         если треугольник не виден
+             */
+            [[nodiscard]] Polygon clip_triangle(
+                const gmath::Vector4<float>& a,
+                const gmath::Vector4<float>& b,
+                const gmath::Vector4<float>& c
+            ) const;
+
+            [[nodiscard]] const Viewport& get_viewport() const;
+            [[nodiscard]] float get_guard_band() const;
+
+        private:
+            struct ClipVertex {
+                gmath::Vector4<float> position;
+                gmath::Vector3<float> barycentric;
+            };
+
+            [[nodiscard]] std::uint32_t outcode(const gmath::Vector4<float>& v, float band) const;
+            [[nodiscard]] ScreenVertex to_screen(const ClipVertex& v) const;
+
+            Viewport m_viewport;
+            float m_guardBand;
+    };
+}
+
+#endif //KGG_CPP_PROJECT_REPO_CLIPPER_H
@@ -0,0 +1,138 @@
+//
+// Created by shulz on 18.12.2025.
+//
+
+#ifndef KGG_CPP_PROJECT_REPO_FRAGMENTLOOP_H
+#define KGG_CPP_PROJECT_REPO_FRAGMENTLOOP_H
+
+#include <algorithm>
+#include <concepts>
+#include <cstdint>
+
+#include "Profile/Profiler.h"
+#include "Render/Rect.h"
+#include "Render/TriangleSetup.h"
+#include "Window/Framebuffer.h"
+
+namespace render {
+    /**
+     * Источник цвета пикселей для fill_depth_triangle. Тип известен на этапе
+     * компиляции, поэтому шейдер встраивается во внутренний цикл без косвенных вызовов:
+     *
+     *   auto row = fragments.row(x, y); // курсор в пикселе (x, y)
+     *   row.step();                     // сдвиг на пиксель вправо, для каждого пикселя строки
+     *   std::uint32_t rgba = row.shade(); // только для пикселей, прошедших тест глубины
+     */
+    template<class F>
+    concept FragmentSource = requires(const F& fragments, int x, int y) {
+        { fragments.row(x, y) };
+        { fragments.row(x, y).shade() } -> std::convertible_to<std::uint32_t>;
+        requires requires(decltype(fragments.row(x, y)) row) { row.step(); };
+    };
+
+    /**
+     * Обход треугольника блоками Framebuffer::DEPTH_BLOCK с тестом глубины.
+     * Глубина интерполируется линейно в экранных координатах (z после
+     * перспективного деления аффинна на экране)
+     *
+     * @param depth глубины вершин a, b, c в исходном порядке
+     */
+    template<FragmentSource Fragments>
+    void fill_depth_triangle(
+        Framebuffer& framebuffer,
+        const TriangleSetup& setup,
+        const float depth[3],
+        const Fragments& fragments
+    ) {
+        framebuffer.mark_dirty(setup.bounds());
+
+        // Вершины в порядке рёбер w0, w1, w2
+        const float z[3] = {
+            depth[0],
+            setup.swapped ? depth[2] : depth[1],
+            setup.swapped ? depth[1] : depth[2]
+        };
+
+        const float z_min = std::min({z[0], z[1], z[2]});
+        const float z_max = std::max({z[0], z[1], z[2]});
+
+        const EdgeFunction& e0 = setup.edges[0];
+        const EdgeFunction& e1 = setup.edges[1];
+        const EdgeFunction& e2 = setup.edges[2];
+
+        // Плоскость глубины: в начале каждой строки блока z считается из точных
+        // целых значений рёбер, дальше по строке прибавляется dz_dx. Так результат
+        // не зависит от того, обрезан ли bounding box тайлом
+        const double inv_area = 1.0 / static_cast<double>(setup.area);
+        const float dz_dx = static_cast<float>(
+            (e0.step_x * double(z[0]) + e1.step_x * double(z[1]) + e2.step_x * double(z[2])) * inv_area);
+
+        constexpr int B = Framebuffer::DEPTH_BLOCK;
+        const Rect bounds = setup.bounds();
+        std::size_t shaded = 0; // для profile, один раз в конце
+
+        for (int block_y = setup.min_y / B; block_y <= setup.max_y / B; ++block_y) {
+            for (int block_x = setup.min_x / B; block_x <= setup.max_x / B; ++block_x) {
+                const Rect block = Rect{block_x * B, block_y * B, (block_x + 1) * B, (block_y + 1) * B}
+                    .intersect(bounds);
+                if (!setup.may_cover(block)) {
+                    continue;
+                }
+                // Hi-Z: весь треугольник не ближе самого дальнего пикселя блока
+                if (z_min >= framebuffer.block_max_depth(block_x, block_y)) {
+                    continue;
+                }
+                // Весь треугольник ближе самого близкого пикселя — сравнение не нужно
+                const bool always_passes = z_max < framebuffer.block_min_depth(block_x, block_y);
+
+                std::int64_t w0_row = e0.at_pixel(block.x0, block.y0);
+                std::int64_t w1_row = e1.at_pixel(block.x0, block.y0);
+                std::int64_t w2_row = e2.at_pixel(block.x0, block.y0);
+                bool written = false;
+
+                for (int y = block.y0; y < block.y1; ++y) {
+                    std::uint32_t* row = framebuffer.get_row(static_cast<uint32_t>(y));
+                    float* depth_row = framebuffer.get_depth_row(static_cast<uint32_t>(y));
+                    const float z_row = static_cast<float>(
+                        (double(w0_row) * z[0] + double(w1_row) * z[1] + double(w2_row) * z[2]) * inv_area);
+
+                    std::int64_t w0 = w0_row;
+                    std::int64_t w1 = w1_row;
+                    std::int64_t w2 = w2_row;
+                    // Блоки выровнены по сетке, поэтому старт строки одинаков с тайлами и без
+                    auto fragment = fragments.row(block.x0, y);
+
+                    for (int x = block.x0; x < block.x1; ++x) {
+                        if ((w0 | w1 | w2) >= 0) {
+                            // Зажим убирает ошибку округления плоскости за пределы [z_min, z_max]
+                            const float pixel_z = std::clamp(
+                                z_row + dz_dx * static_cast<float>(x - block.x0), z_min, z_max);
+
+                            if (always_passes || pixel_z < depth_row[x]) {
+                                depth_row[x] = pixel_z;
+                                written = true;
+                                row[x] = fragment.shade();
+                                ++shaded;
+                            }
+                        }
+                        w0 += e0.step_x;
+                        w1 += e1.step_x;
+                        w2 += e2.step_x;
+                        fragment.step();
+                    }
+
+                    w0_row += e0.step_y;
+                    w1_row += e1.step_y;
+                    w2_row += e2.step_y;
+                }
+
+                if (written) {
+                    framebuffer.note_depth_write(block_x, block_y, z_min);
+                }
+            }
+        }
+        KGG_PROFILE_COUNT(pixels_shaded, shaded);
+    }
+}
+
+#endif //KGG_CPP_PROJECT_REPO_FRAGMENTLOOP_H
@@ -0,0 +1,163 @@
+//
+// Created by shulz on 18.12.2025.
+//
+
+#ifndef KGG_CPP_PROJECT_REPO_INTERPOLATOR_H
+#define KGG_CPP_PROJECT_REPO_INTERPOLATOR_H
+
+#include <array>
+#include <cstddef>
+
+#include "Render/TriangleSetup.h"
+
+namespace render {
+    /**
+     * Плоскость атрибута на экране: v(x, y) = dx * x + dy * y + c,
+     * (x, y) — пиксель, значение берётся в его центре.
+     *
+     * Строится из целых уравнений рёбер TriangleSetup: барицентрическая
+     * координата вершины i равна w_i(x, y) / area, а w_i линейна по пикселям
+     */
+    struct AttributePlane {
+        double dx = 0.0, dy = 0.0, c = 0.0;
+
+        /**
+         * @param values значения в вершинах в порядке рёбер w0, w1, w2
+         */
+        static AttributePlane create(const TriangleSetup& setup, const double values[3]) {
+            AttributePlane plane;
+            for (int i = 0; i < 3; ++i) {
+                const EdgeFunction& e = setup.edges[i];
+                plane.dx += static_cast<double>(e.step_x) * values[i];
+                plane.dy += static_cast<double>(e.step_y) * values[i];
+                plane.c += static_cast<double>(e.at_pixel(0, 0)) * values[i];
+            }
+            const double inv_area = 1.0 / static_cast<double>(setup.area);
+            plane.dx *= inv_area;
+            plane.dy *= inv_area;
+            plane.c *= inv_area;
+            return plane;
+        }
+
+        [[nodiscard]] double at(int x, int y) const {
+            return dx * x + dy * y + c;
+        }
+    };
+
+    /**
+     * Интерполяция N float-атрибутов (varyings) по треугольнику.
+     *
+     * Плоскости считаются один раз на треугольник. При перспективной коррекции
+     * интерполируются f / w и 1 / w — обе величины аффинны на экране, значение
+     * в пикселе — их отношение. Проход по строке (Cursor) — только сложения
+     * плюс одно деление на пиксель для всех атрибутов сразу (в аффинном случае
+     * деления нет).
+     *
+     * Начало строки всегда считается точно в double (at), поэтому результат
+     * не зависит от того, с какого пикселя начат обход: тайлы TiledRenderer
+     * и последовательный Rasterizer дают одно и то же, если старт строки выровнен
+     */
+    template<std::size_t N>
+    class Interpolator {
+        public:
+            using Values = std::array<float, N>;
+
+            class Cursor {
+                public:
+                    // Сдвиг на пиксель вправо
+                    void step() noexcept {
+                        for (std::size_t i = 0; i < N; ++i) {
+                            m_value[i] += m_step[i];
+                        }
+                        m_q += m_dq;
+                    }
+
+                    [[nodiscard]] Values get() const noexcept {
+                        if (!m_perspective) {
+                            return m_value;
+                        }
+                        const float w = 1.0f / m_q;
+                        Values result;
+                        for (std::size_t i = 0; i < N; ++i) {
+                            result[i] = m_value[i] * w;
+                        }
+                        return result;
+                    }
+
+                private:
+                    friend class Interpolator;
+
+                    Values m_value{};
+                    Values m_step{};
+                    float m_q = 1.0f;
+                    float m_dq = 0.0f;
+                    bool m_perspective = false;
+            };
+
+            Interpolator() = default;
+
+            /**
+             * @param vertices атрибуты вершин a, b, c в исходном порядке (до перестановки в TriangleSetup)
+             * @param inv_w 1 / w вершин (ScreenVertex::inv_w); nullptr или равные значения —
+             *              аффинная интерполяция без деления на пиксель
+             */
+            Interpolator(const TriangleSetup& setup, const Values vertices[3], const float inv_w[3] = nullptr) {
+                // Вершины в порядке рёбер w0, w1, w2
+                const int order[3] = {0, setup.swapped ? 2 : 1, setup.swapped ? 1 : 2};
+
+                m_perspective = inv_w != nullptr && (inv_w[0] != inv_w[1] || inv_w[0] != inv_w[2]);
+
+                double q[3] = {1.0, 1.0, 1.0};
+                if (m_perspective) {
+                    for (int i = 0; i < 3; ++i) {
+                        q[i] = inv_w[order[i]];
+                    }
+                    m_q = AttributePlane::create(setup, q);
+                }
+
+                for (std::size_t k = 0; k < N; ++k) {
+                    double values[3];
+                    for (int i = 0; i < 3; ++i) {
+                        values[i] = static_cast<double>(vertices[order[i]][k]) * q[i];
+                    }
+                    m_planes[k] = AttributePlane::create(setup, values);
+                }
+            }
+
+            [[nodiscard]] bool perspective() const {
+                return m_perspective;
+            }
+
+            // Курсор в пикселе (x, y) для прохода по строке вправо
+            [[nodiscard]] Cursor at(int x, int y) const {
+                Cursor cursor;
+                for (std::size_t k = 0; k < N; ++k) {
+                    cursor.m_value[k] = static_cast<float>(m_planes[k].at(x, y));
+                    cursor.m_step[k] = static_cast<float>(m_planes[k].dx);
+                }
+                if (m_perspective) {
+                    cursor.m_q = static_cast<float>(m_q.at(x, y));
+                    cursor.m_dq = static_cast<float>(m_q.dx);
+                    cursor.m_perspective = true;
+                }
+                return cursor;
+            }
+
+            // Точное значение в пикселе, без накопления ошибки шагов
+            [[nodiscard]] Values value_at(int x, int y) const {
+                const double w = m_perspective ? 1.0 / m_q.at(x, y) : 1.0;
+                Values result;
+                for (std::size_t k = 0; k < N; ++k) {
+                    result[k] = static_cast<float>(m_planes[k].at(x, y) * w);
+                }
+                return result;
+            }
+
+        private:
+            std::array<AttributePlane, N> m_planes{};
+            AttributePlane m_q{0.0, 0.0, 1.0};
+            bool m_perspective = false;
+    };
+}
+
+#endif //KGG_CPP_PROJECT_REPO_INTERPOLATOR_H
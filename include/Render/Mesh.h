@@ -5,11 +5,103 @@
 #ifndef KGG_CPP_PROJECT_REPO_MESH_H
 #define KGG_CPP_PROJECT_REPO_MESH_H
 
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <vector>
 
+#include "Math/MeshView.hpp"
+#include "Math/Vector2.hpp"
+#include "Math/Vector3.hpp"
+#include "Window/AlignedAllocator.hpp"
+
+namespace io {
+    struct ObjData;
+    class MeshCache;
+}
+
+/**
+ * Геометрия модели в непрерывной памяти
+ *
+ * - вершины хранятся потоками (SoA): x[], y[], z[], nx[], ... — пакетные
+ *   преобразования читают подряд идущие float
+ * - грани при загрузке триангулируются веером, indices — плоский список треугольников
+ * - face_offsets хранит для исходной грани i треугольники [face_offsets[i], face_offsets[i + 1])
+ */
 class Mesh {
-public:
+    public:
+        using Stream = std::vector<float, render::AlignedAllocator<float>>;
+
+        Mesh() = default;
+
+        /**
+         * Вершины — io::ObjData::indexed(): углы OBJ с разными наборами (v, vt, vn)
+         * становятся разными вершинами меша, отсутствующие нормали считаются по граням
+         */
+        static Mesh from_obj(const io::ObjData& obj);
+        // Те же вершины из кэша: from_cache(MeshCache::build(obj)) — from_obj(obj) с оптимизированным порядком
+        static Mesh from_cache(const io::MeshCache& cache);
+
+        // Через бинарный кэш (io::MeshCache::load)
+        static Mesh load(const std::string& obj_path);
+
+        [[nodiscard]] std::size_t vertex_count() const { return m_x.size(); }
+        [[nodiscard]] std::size_t triangle_count() const { return m_indices.size() / 3; }
+        [[nodiscard]] std::size_t face_count() const { return m_faceOffsets.size() - 1; }
+
+        [[nodiscard]] bool has_normals() const { return !m_nx.empty(); }
+        [[nodiscard]] bool has_texcoords() const { return !m_u.empty(); }
+
+        [[nodiscard]] std::span<const float> x() const { return m_x; }
+        [[nodiscard]] std::span<const float> y() const { return m_y; }
+        [[nodiscard]] std::span<const float> z() const { return m_z; }
+        [[nodiscard]] std::span<const float> nx() const { return m_nx; }
+        [[nodiscard]] std::span<const float> ny() const { return m_ny; }
+        [[nodiscard]] std::span<const float> nz() const { return m_nz; }
+        [[nodiscard]] std::span<const float> u() const { return m_u; }
+        [[nodiscard]] std::span<const float> v() const { return m_v; }
+
+        [[nodiscard]] std::span<const std::uint32_t> indices() const { return m_indices; }
+        [[nodiscard]] std::span<const std::uint32_t> face_offsets() const { return m_faceOffsets; }
+
+        [[nodiscard]] gmath::Vector3f position(std::uint32_t i) const { return {m_x[i], m_y[i], m_z[i]}; }
+        [[nodiscard]] gmath::Vector3f normal(std::uint32_t i) const { return {m_nx[i], m_ny[i], m_nz[i]}; }
+        [[nodiscard]] gmath::Vector2f texcoord(std::uint32_t i) const { return {m_u[i], m_v[i]}; }
+
+        // Позиции и треугольники для gmath::Normal и др.
+        [[nodiscard]] gmath::MeshView<float> view() const;
+
+        // Пересчитать нормали вершин по треугольникам (вес — площадь, Normal::compute_all)
+        void compute_normals();
+
+        /**
+         * Офлайн-оптимизация порядка: грани по Tipsify, вершины по первому использованию.
+         * Грани остаются целыми (face_offsets пересобирается), меняется только порядок
+         */
+        void optimize(std::size_t cache_size = 16);
+
+        void set_position(std::uint32_t i, const gmath::Vector3f& p) {
+            m_x[i] = p.x;
+            m_y[i] = p.y;
+            m_z[i] = p.z;
+        }
+
+    private:
+        void assign_vertices(
+            std::span<const gmath::Vector3f> positions,
+            std::span<const gmath::Vector3f> normals,
+            std::span<const gmath::Vector2f> texcoords
+        );
+        void triangulate(std::span<const std::uint32_t> polygon_indices, std::span<const std::uint32_t> polygon_offsets);
+
+        Stream m_x, m_y, m_z;
+        Stream m_nx, m_ny, m_nz;
+        Stream m_u, m_v;
 
+        std::vector<std::uint32_t> m_indices;
+        std::vector<std::uint32_t> m_faceOffsets{0};
 };
 
 
-#endif //KGG_CPP_PROJECT_REPO_MESH_H
\ No newline at end of file
+#endif //KGG_CPP_PROJECT_REPO_MESH_H
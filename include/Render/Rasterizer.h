@@ -5,7 +5,10 @@
 #ifndef KGG_CPP_PROJECT_REPO_RASTERIZER_H
 #define KGG_CPP_PROJECT_REPO_RASTERIZER_H
 #include "Math/Vector2.hpp"
-#include "SFML/Graphics/Color.hpp"
+#include "Math/Vector3.hpp"
+#include "Render/Clipper.h"
+#include "Render/Rect.h"
+#include "Render/TriangleSetup.h"
 #include "Window/Framebuffer.h"
 
 namespace render {
@@ -19,6 +22,15 @@ namespace render {
             const Color& color
         );
 
+        static void draw_triangle(
+            Framebuffer& framebuffer,
+            const gmath::Vector2<float> a,
+            const gmath::Vector2<float> b,
+            const gmath::Vector2<float> c,
+            const Color& color,
+            const Rect& scissor
+        );
+
         static void draw_colored_triangle(
         Framebuffer& framebuffer,
         const gmath::Vector2<float> a,
@@ -28,6 +40,97 @@ namespace render {
         const Color& color_b,
         const Color& color_c
         );
+
+        static void draw_colored_triangle(
+        Framebuffer& framebuffer,
+        const gmath::Vector2<float> a,
+        const gmath::Vector2<float> b,
+        const gmath::Vector2<float> c,
+        const Color& color_a,
+        const Color& color_b,
+        const Color& color_c,
+        const Rect& scissor
+        );
+
+        // Растеризация уже настроенного треугольника: TiledRenderer делает
+        // TriangleSetup один раз и вызывает их для каждого тайла
+        static void fill_triangle(
+            Framebuffer& framebuffer,
+            const TriangleSetup& setup,
+            const Color& color
+        );
+
+        static void fill_colored_triangle(
+            Framebuffer& framebuffer,
+            const TriangleSetup& setup,
+            const Color& color_a,
+            const Color& color_b,
+            const Color& color_c
+        );
+
+        // ---------- С тестом глубины ----------
+        // x, y — экранные координаты, z — глубина в [0, 1] (меньше — ближе).
+        // Блоки, где треугольник заведомо закрыт, отбрасываются по иерархическому
+        // z-буферу Framebuffer до обхода пикселей; цвет считается только после теста
+
+        static void draw_triangle(
+            Framebuffer& framebuffer,
+            const gmath::Vector3<float>& a,
+            const gmath::Vector3<float>& b,
+            const gmath::Vector3<float>& c,
+            const Color& color
+        );
+
+        static void draw_colored_triangle(
+            Framebuffer& framebuffer,
+            const gmath::Vector3<float>& a,
+            const gmath::Vector3<float>& b,
+            const gmath::Vector3<float>& c,
+            const Color& color_a,
+            const Color& color_b,
+            const Color& color_c
+        );
+
+        // depth — глубины вершин a, b, c в исходном порядке
+        static void fill_triangle(
+            Framebuffer& framebuffer,
+            const TriangleSetup& setup,
+            const float depth[3],
+            const Color& color
+        );
+
+        static void fill_colored_triangle(
+            Framebuffer& framebuffer,
+            const TriangleSetup& setup,
+            const float depth[3],
+            const Color& color_a,
+            const Color& color_b,
+            const Color& color_c
+        );
+
+        // ---------- Перспективно-корректная интерполяция ----------
+        // Вершины после Clipper: цвет интерполируется через 1 / w (см. Interpolator)
+
+        static void draw_colored_triangle(
+            Framebuffer& framebuffer,
+            const ScreenVertex& a,
+            const ScreenVertex& b,
+            const ScreenVertex& c,
+            const Color& color_a,
+            const Color& color_b,
+            const Color& color_c
+        );
+
+        // inv_w — 1 / w вершин a, b, c; nullptr — аффинная интерполяция
+        static void fill_colored_triangle(
+            Framebuffer& framebuffer,
+            const TriangleSetup& setup,
+            const float depth[3],
+            const float inv_w[3],
+            const Color& color_a,
+            const Color& color_b,
+            const Color& color_c
+        );
     };
 }
 
@@ -0,0 +1,70 @@
+//
+// Created by shulz on 18.12.2025.
+//
+
+#ifndef KGG_CPP_PROJECT_REPO_RASTERIZERSIMD_H
+#define KGG_CPP_PROJECT_REPO_RASTERIZERSIMD_H
+
+#include <cstddef>
+#include <cstdint>
+
+#include "Render/TriangleSetup.h"
+
+namespace render::simd {
+    /**
+     * Набор инструкций, которым проверяется покрытие пикселей.
+     * Выбирается один раз при первом вызове по возможностям процессора
+     */
+    enum class Isa {
+        scalar, // по одному пикселю
+        sse2,   // 4 пикселя
+        avx2    // 8 пикселей
+    };
+
+    [[nodiscard]] Isa detect_isa();
+    [[nodiscard]] Isa active_isa();
+
+    // Принудительный выбор пути (тесты, сравнение производительности).
+    // Если процессор не поддерживает isa, используется detect_isa()
+    void force_isa(Isa isa);
+
+    /**
+     * Треугольник после TriangleSetup, значения рёбер в int32.
+     * w_row — значения в центре пикселя (min_x, min_y)
+     */
+    struct TriangleJob {
+        std::uint32_t* pixels; // Color::to_rgba32(), начало строки 0
+        std::size_t stride;    // пикселей в строке
+        int min_x, max_x, min_y, max_y;
+        std::int32_t w_row[3];
+        std::int32_t step_x[3];
+        std::int32_t step_y[3];
+    };
+
+    /**
+     * Можно ли вести значения рёбер в int32 во всём bounding box.
+     * Функция линейна, поэтому достаточно проверить углы
+     */
+    [[nodiscard]] bool fits_int32(const TriangleSetup& setup);
+
+    [[nodiscard]] TriangleJob make_job(
+        const TriangleSetup& setup,
+        std::uint32_t* pixels,
+        std::size_t stride
+    );
+
+    // Ядра возвращают число записанных пикселей (для счётчика profile)
+
+    std::size_t fill_triangle(const TriangleJob& job, std::uint32_t rgba);
+
+    /**
+     * @param colors цвета вершин (r, g, b, a) уже в порядке рёбер w0, w1, w2
+     */
+    std::size_t fill_colored_triangle(
+        const TriangleJob& job,
+        float inv_area,
+        const float colors[3][4]
+    );
+}
+
+#endif //KGG_CPP_PROJECT_REPO_RASTERIZERSIMD_H
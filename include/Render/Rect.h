@@ -0,0 +1,43 @@
+//
+// Created by shulz on 18.12.2025.
+//
+
+#ifndef KGG_CPP_PROJECT_REPO_RECT_H
+#define KGG_CPP_PROJECT_REPO_RECT_H
+
+#include <algorithm>
+
+namespace render {
+    /**
+     * Прямоугольник в пикселях: [x0, x1) x [y0, y1)
+     * Используется как scissor для растеризатора и как границы тайла
+     */
+    struct Rect {
+        int x0 = 0, y0 = 0, x1 = 0, y1 = 0;
+
+        [[nodiscard]] constexpr bool empty() const {
+            return x0 >= x1 || y0 >= y1;
+        }
+
+        [[nodiscard]] constexpr int width() const {
+            return x1 - x0;
+        }
+
+        [[nodiscard]] constexpr int height() const {
+            return y1 - y0;
+        }
+
+        [[nodiscard]] constexpr Rect intersect(const Rect& other) const {
+            return {
+                std::max(x0, other.x0),
+                std::max(y0, other.y0),
+                std::min(x1, other.x1),
+                std::min(y1, other.y1)
+            };
+        }
+
+        constexpr bool operator==(const Rect&) const = default;
+    };
+}
+
+#endif //KGG_CPP_PROJECT_REPO_RECT_H
@@ -5,12 +5,36 @@
 #ifndef KGG_CPP_PROJECT_REPO_RENDER_H
 #define KGG_CPP_PROJECT_REPO_RENDER_H
 
+#include "Math/Matrix4.hpp"
+#include "Window/Color.hpp"
+
+class Mesh;
+
+namespace render {
+    class Clipper;
+    class TiledRenderer;
+    class VertexStage;
+}
 
 class Render {
 public:
-    static void render(float vertices[], unsigned int indices[]);
+    /**
+     * Нарисовать меш с тестом глубины
+     *
+     * Вершины обрабатываются пакетно в stage, треугольники уходят в target
+     * (между begin_frame и end_frame). Треугольники с вершинами за near/far
+     * или guard band проходят через clipper, остальные — напрямую
+     */
+    static void render(
+        const Mesh& mesh,
+        const gmath::Matrix4<float>& mvp,
+        const render::Clipper& clipper,
+        render::VertexStage& stage,
+        render::TiledRenderer& target,
+        const render::Color& color
+    );
 
 };
 
 
-#endif //KGG_CPP_PROJECT_REPO_RENDER_H
\ No newline at end of file
+#endif //KGG_CPP_PROJECT_REPO_RENDER_H
@@ -0,0 +1,249 @@
+//
+// Created by shulz on 18.12.2025.
+//
+
+#ifndef KGG_CPP_PROJECT_REPO_SHADERPIPELINE_H
+#define KGG_CPP_PROJECT_REPO_SHADERPIPELINE_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+#include "Math/Matrix4.hpp"
+#include "Render/Clipper.h"
+#include "Render/FragmentLoop.h"
+#include "Render/Interpolator.h"
+#include "Render/Mesh.h"
+#include "Render/ThreadPool.h"
+#include "Render/TriangleSetup.h"
+#include "Render/VertexStage.h"
+#include "Render/shader.h"
+#include "Window/Framebuffer.h"
+
+namespace render {
+    /**
+     * Отрисовка меша шейдером S (см. shader.h) с тестом глубины
+     *
+     * 1. VertexStage: позиции -> clip space / экран
+     * 2. S::vertex для всех вершин параллельно, S::primitive — на треугольник
+     * 3. треугольники с вершинами за near/far или guard band режутся Clipper,
+     *    varyings новых вершин — по их барицентрическим весам (в clip space они линейны)
+     * 4. TriangleSetup и плоскости Interpolator — один раз на треугольник, затем
+     *    раскладка по тайлам Framebuffer::TILE_SIZE, как в TiledRenderer
+     * 5. тайлы растеризуются параллельно fill_depth_triangle, S::fragment встраивается
+     *
+     * Буферы переиспользуются между кадрами
+     */
+    template<Shader S>
+    class ShaderPipeline {
+        public:
+            static constexpr std::size_t VARYINGS = S::VARYINGS;
+            static constexpr int TILE_SIZE = Framebuffer::TILE_SIZE;
+
+            using Values = Varyings<VARYINGS>;
+
+            explicit ShaderPipeline(ThreadPool& pool) : m_pool(pool) {}
+
+            /**
+             * Буфер глубины target должен быть очищен вызывающим (Framebuffer::clear_depth).
+             * Шейдер с NEEDS_NORMALS и меш без нормалей — std::invalid_argument
+             */
+            void draw(
+                const Mesh& mesh,
+                const S& shader,
+                const gmath::Matrix4<float>& mvp,
+                const Clipper& clipper,
+                VertexStage& stage,
+                Framebuffer& target
+            ) {
+                if constexpr (NeedsNormals<S>) {
+                    if (!mesh.has_normals()) {
+                        throw std::invalid_argument("Shader needs vertex normals, mesh has none");
+                    }
+                }
+                stage.process(mesh, mvp, clipper);
+                run_vertex_shader(mesh, shader);
+                bin_triangles(mesh, shader, clipper, stage, target);
+                rasterize(shader, target);
+            }
+
+        private:
+            struct Triangle {
+                TriangleSetup setup;
+                float depth[3];
+                Interpolator<VARYINGS> interpolator;
+            };
+
+            // Источник цвета для fill_depth_triangle: курсор Interpolator + S::fragment
+            struct Fragments {
+                const S& shader;
+                const Interpolator<VARYINGS>& interpolator;
+
+                struct Row {
+                    const S& shader;
+                    typename Interpolator<VARYINGS>::Cursor cursor;
+
+                    void step() { cursor.step(); }
+                    [[nodiscard]] std::uint32_t shade() const { return shader.fragment(cursor.get()); }
+                };
+
+                [[nodiscard]] Row row(int x, int y) const { return {shader, interpolator.at(x, y)}; }
+            };
+
+            void run_vertex_shader(const Mesh& mesh, const S& shader) {
+                KGG_PROFILE_SCOPE(transform);
+                const std::size_t count = mesh.vertex_count();
+                m_vertexValues.resize(count);
+                const std::size_t blocks = (count + VertexStage::BLOCK_SIZE - 1) / VertexStage::BLOCK_SIZE;
+                m_pool.parallel_for(blocks, [&](std::size_t block) {
+                    const std::size_t begin = block * VertexStage::BLOCK_SIZE;
+                    const std::size_t end = std::min(count, begin + VertexStage::BLOCK_SIZE);
+                    for (std::size_t i = begin; i < end; ++i) {
+                        shader.vertex(mesh, static_cast<std::uint32_t>(i), m_vertexValues[i]);
+                    }
+                });
+            }
+
+            // Отсечение, TriangleSetup и раскладка треугольников по тайлам
+            void bin_triangles(
+                const Mesh& mesh,
+                const S& shader,
+                const Clipper& clipper,
+                const VertexStage& stage,
+                const Framebuffer& target
+            ) {
+                KGG_PROFILE_SCOPE(binning);
+                const Rect full{0, 0, static_cast<int>(target.get_width()), static_cast<int>(target.get_height())};
+                m_scissor = clipper.get_viewport().rect().intersect(full);
+                m_triangles.clear();
+                m_tilesX = (full.x1 + TILE_SIZE - 1) / TILE_SIZE;
+                m_tilesY = (full.y1 + TILE_SIZE - 1) / TILE_SIZE;
+                m_bins.resize(static_cast<std::size_t>(m_tilesX) * m_tilesY);
+                for (auto& bin : m_bins) {
+                    bin.clear();
+                }
+
+                const auto indices = mesh.indices();
+                const auto inv_w = stage.inv_w();
+                std::size_t culled = 0;
+                for (std::size_t i = 0; i + 2 < indices.size(); i += 3) {
+                    const std::size_t added = m_triangles.size();
+                    const std::uint32_t corner[3] = {indices[i], indices[i + 1], indices[i + 2]};
+                    Values values[3] = {m_vertexValues[corner[0]], m_vertexValues[corner[1]], m_vertexValues[corner[2]]};
+                    if constexpr (HasPrimitiveStage<S>) {
+                        shader.primitive(static_cast<std::uint32_t>(i / 3), values);
+                    }
+
+                    if (!stage.needs_clipping(corner[0]) && !stage.needs_clipping(corner[1]) &&
+                        !stage.needs_clipping(corner[2])) {
+                        const ScreenVertex vertices[3] = {
+                            {stage.screen(corner[0]), inv_w[corner[0]], {}},
+                            {stage.screen(corner[1]), inv_w[corner[1]], {}},
+                            {stage.screen(corner[2]), inv_w[corner[2]], {}}
+                        };
+                        add_triangle(vertices, values);
+                        culled += m_triangles.size() == added;
+                        continue;
+                    }
+
+                    const Clipper::Polygon polygon = clipper.clip_triangle(
+                        stage.clip(corner[0]), stage.clip(corner[1]), stage.clip(corner[2]));
+                    if (polygon.count < 3) {
+                        ++culled;
+                        continue;
+                    }
+                    std::array<Values, Clipper::MAX_VERTICES> clipped_values;
+                    for (int k = 0; k < polygon.count; ++k) {
+                        const gmath::Vector3<float>& weights = polygon.vertices[k].barycentric;
+                        for (std::size_t v = 0; v < VARYINGS; ++v) {
+                            clipped_values[k][v] =
+                                weights.x * values[0][v] + weights.y * values[1][v] + weights.z * values[2][v];
+                        }
+                    }
+                    for (int k = 1; k + 1 < polygon.count; ++k) {
+                        const ScreenVertex vertices[3] = {polygon.vertices[0], polygon.vertices[k], polygon.vertices[k + 1]};
+                        const Values fan[3] = {clipped_values[0], clipped_values[k], clipped_values[k + 1]};
+                        add_triangle(vertices, fan);
+                    }
+                    culled += m_triangles.size() == added;
+                }
+
+                // Треугольник меша считается отброшенным, если ни один его кусок не попал в растеризацию
+                KGG_PROFILE_COUNT(triangles_submitted, indices.size() / 3);
+                KGG_PROFILE_COUNT(triangles_culled, culled);
+                KGG_PROFILE_COUNT(triangles_rasterized, m_triangles.size());
+            }
+
+            void add_triangle(const ScreenVertex vertices[3], const Values values[3]) {
+                const auto setup = TriangleSetup::create(
+                    {vertices[0].position.x, vertices[0].position.y},
+                    {vertices[1].position.x, vertices[1].position.y},
+                    {vertices[2].position.x, vertices[2].position.y},
+                    m_scissor
+                    );
+                if (!setup) {
+                    return;
+                }
+                const float inv_w[3] = {vertices[0].inv_w, vertices[1].inv_w, vertices[2].inv_w};
+                const auto index = static_cast<std::uint32_t>(m_triangles.size());
+                m_triangles.push_back({
+                    *setup,
+                    {vertices[0].position.z, vertices[1].position.z, vertices[2].position.z},
+                    Interpolator<VARYINGS>(*setup, values, inv_w)
+                });
+
+                const bool single_tile = setup->min_x / TILE_SIZE == setup->max_x / TILE_SIZE &&
+                                         setup->min_y / TILE_SIZE == setup->max_y / TILE_SIZE;
+                for (int ty = setup->min_y / TILE_SIZE; ty <= setup->max_y / TILE_SIZE; ++ty) {
+                    for (int tx = setup->min_x / TILE_SIZE; tx <= setup->max_x / TILE_SIZE; ++tx) {
+                        if (!single_tile && !setup->may_cover(tile_rect(tx, ty))) {
+                            continue;
+                        }
+                        m_bins[static_cast<std::size_t>(ty) * m_tilesX + tx].push_back(index);
+                    }
+                }
+            }
+
+            void rasterize(const S& shader, Framebuffer& target) {
+                KGG_PROFILE_SCOPE(raster);
+                m_activeTiles.clear();
+                for (std::size_t i = 0; i < m_bins.size(); ++i) {
+                    if (!m_bins[i].empty()) {
+                        m_activeTiles.push_back(static_cast<std::uint32_t>(i));
+                    }
+                }
+
+                m_pool.parallel_for(m_activeTiles.size(), [&](std::size_t task) {
+                    KGG_PROFILE_SCOPE(tile);
+                    const std::uint32_t tile = m_activeTiles[task];
+                    const Rect rect = tile_rect(static_cast<int>(tile % m_tilesX), static_cast<int>(tile / m_tilesX));
+                    for (const std::uint32_t index : m_bins[tile]) {
+                        const Triangle& triangle = m_triangles[index];
+                        const auto clipped = triangle.setup.clipped(rect);
+                        if (clipped) {
+                            fill_depth_triangle(target, *clipped, triangle.depth, Fragments{shader, triangle.interpolator});
+                        }
+                    }
+                });
+            }
+
+            [[nodiscard]] Rect tile_rect(int tile_x, int tile_y) const {
+                return Rect{tile_x * TILE_SIZE, tile_y * TILE_SIZE, (tile_x + 1) * TILE_SIZE, (tile_y + 1) * TILE_SIZE}
+                    .intersect(m_scissor);
+            }
+
+            ThreadPool& m_pool;
+            Rect m_scissor{};
+            int m_tilesX = 0;
+            int m_tilesY = 0;
+
+            std::vector<Values> m_vertexValues;
+            std::vector<Triangle> m_triangles;
+            std::vector<std::vector<std::uint32_t>> m_bins; // индексы m_triangles по тайлам
+            std::vector<std::uint32_t> m_activeTiles;
+    };
+}
+
+#endif //KGG_CPP_PROJECT_REPO_SHADERPIPELINE_H
@@ -0,0 +1,15 @@
+//
+// Created by shulz on 18.12.2025.
+//
+
+#ifndef KGG_CPP_PROJECT_REPO_THREADPOOL_H
+#define KGG_CPP_PROJECT_REPO_THREADPOOL_H
+
+#include "Math/ThreadPool.hpp"
+
+namespace render {
+    // Пул общий с параллельными алгоритмами gmath (Math/ThreadPool.hpp)
+    using ThreadPool = gmath::ThreadPool;
+}
+
+#endif //KGG_CPP_PROJECT_REPO_THREADPOOL_H
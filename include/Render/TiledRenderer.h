@@ -0,0 +1,110 @@
+//
+// Created by shulz on 18.12.2025.
+//
+
+#ifndef KGG_CPP_PROJECT_REPO_TILEDRENDERER_H
+#define KGG_CPP_PROJECT_REPO_TILEDRENDERER_H
+
+#include <cstdint>
+#include <vector>
+
+#include "Math/Vector2.hpp"
+#include "Math/Vector3.hpp"
+#include "Render/Clipper.h"
+#include "Render/Rect.h"
+#include "Render/ThreadPool.h"
+#include "Render/TriangleSetup.h"
+#include "Window/Framebuffer.h"
+
+namespace render {
+    /**
+     * Тайловый растеризатор:
+     * 1. draw_* делает TriangleSetup и раскладывает треугольник по корзинам тайлов,
+     *    которые он может покрыть
+     * 2. end_frame растеризует тайлы параллельно на ThreadPool; каждый тайл
+     *    целиком принадлежит одному потоку, поэтому Framebuffer не блокируется
+     *
+     * Внутри тайла треугольники рисуются в порядке отправки, результат
+     * совпадает с последовательными вызовами Rasterizer
+     */
+    class TiledRenderer {
+        public:
+            static constexpr int TILE_SIZE = Framebuffer::TILE_SIZE;
+
+            explicit TiledRenderer(ThreadPool& pool);
+
+            void begin_frame(Framebuffer& framebuffer);
+
+            void draw_triangle(
+                const gmath::Vector2<float>& a,
+                const gmath::Vector2<float>& b,
+                const gmath::Vector2<float>& c,
+                const Color& color
+            );
+
+            void draw_colored_triangle(
+                const gmath::Vector2<float>& a,
+                const gmath::Vector2<float>& b,
+                const gmath::Vector2<float>& c,
+                const Color& color_a,
+                const Color& color_b,
+                const Color& color_c
+            );
+
+            // С тестом глубины, см. Rasterizer
+            void draw_triangle(
+                const gmath::Vector3<float>& a,
+                const gmath::Vector3<float>& b,
+                const gmath::Vector3<float>& c,
+                const Color& color
+            );
+
+            void draw_colored_triangle(
+                const gmath::Vector3<float>& a,
+                const gmath::Vector3<float>& b,
+                const gmath::Vector3<float>& c,
+                const Color& color_a,
+                const Color& color_b,
+                const Color& color_c
+            );
+
+            // Перспективно-корректный цвет, вершины после Clipper
+            void draw_colored_triangle(
+                const ScreenVertex& a,
+                const ScreenVertex& b,
+                const ScreenVertex& c,
+                const Color& color_a,
+                const Color& color_b,
+                const Color& color_c
+            );
+
+            void end_frame();
+
+            [[nodiscard]] Rect tile_rect(int tile_x, int tile_y) const;
+
+        private:
+            struct Command {
+                TriangleSetup setup;
+                Color colors[3];
+                float depth[3];
+                float inv_w[3];
+                bool colored;
+                bool depth_test;
+            };
+
+            [[nodiscard]] Rect target_rect() const;
+            void bin(const Command& command);
+
+            ThreadPool& m_pool;
+            Framebuffer* m_target = nullptr;
+            int m_tiles_x = 0;
+            int m_tiles_y = 0;
+
+            std::vector<Command> m_commands;
+            std::size_t m_submitted = 0; // вызовов draw_* за кадр, для profile
+            std::vector<std::vector<std::uint32_t>> m_bins; // индексы m_commands по тайлам
+            std::vector<std::uint32_t> m_active_tiles;
+    };
+}
+
+#endif //KGG_CPP_PROJECT_REPO_TILEDRENDERER_H
@@ -0,0 +1,183 @@
+//
+// Created by shulz on 18.12.2025.
+//
+
+#ifndef KGG_CPP_PROJECT_REPO_TRIANGLESETUP_H
+#define KGG_CPP_PROJECT_REPO_TRIANGLESETUP_H
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <optional>
+
+#include "Math/Vector2.hpp"
+#include "Render/Rect.h"
+
+namespace render {
+    // Вершины переводятся в формат с фиксированной точкой 28.4:
+    // 16 субпикселей на пиксель, все вычисления рёбер — целочисленные
+    constexpr int SUBPIXEL_BITS = 4;
+    constexpr std::int64_t SUBPIXEL_ONE = std::int64_t(1) << SUBPIXEL_BITS;
+    constexpr std::int64_t SUBPIXEL_HALF = SUBPIXEL_ONE / 2;
+
+    // Предел |x|, |y| вершины в пикселях: при нём произведения координат 28.4
+    // в площади и EdgeFunction (до 2^59) гарантированно помещаются в int64.
+    // Clipper держит вершины в guard band, много ближе
+    constexpr float MAX_COORDINATE = float(1 << 24);
+
+    struct FixedPoint2 {
+        std::int64_t x, y;
+    };
+
+    inline FixedPoint2 to_fixed(const gmath::Vector2<float>& v) {
+        return {
+            std::llround(static_cast<double>(v.x) * SUBPIXEL_ONE),
+            std::llround(static_cast<double>(v.y) * SUBPIXEL_ONE)
+        };
+    }
+
+    /**
+     * Уравнение ребра v0 -> v1 в виде E(p) = a * p.x + b * p.y + c
+     * Знак совпадает с edge(v0, v1, p) = (p.x - v0.x) * (v1.y - v0.y) - (p.y - v0.y) * (v1.x - v0.x)
+     *
+     * Для рёбер, не являющихся верхними или левыми, c уменьшено на 1:
+     * пиксель, центр которого лежит ровно на таком ребре, получает E < 0
+     * и не закрашивается (top-left fill rule)
+     */
+    struct EdgeFunction {
+        std::int64_t a, b, c;
+        std::int64_t step_x, step_y; // приращение E при сдвиге на один пиксель
+
+        EdgeFunction() = default;
+
+        EdgeFunction(const FixedPoint2& v0, const FixedPoint2& v1)
+            : a(v1.y - v0.y),
+              b(v0.x - v1.x),
+              c(0),
+              step_x(a * SUBPIXEL_ONE),
+              step_y(b * SUBPIXEL_ONE)
+        {
+            c = -(a * v0.x + b * v0.y);
+            // Треугольник ориентирован так, что площадь положительна:
+            // левое ребро идёт вниз (a > 0), верхнее — справа налево (a == 0, b > 0)
+            const bool top_left = a > 0 || (a == 0 && b > 0);
+            if (!top_left) {
+                c -= 1;
+            }
+        }
+
+        // Значение в центре пикселя (x, y)
+        [[nodiscard]] std::int64_t at_pixel(int x, int y) const {
+            return a * (x * SUBPIXEL_ONE + SUBPIXEL_HALF)
+                 + b * (y * SUBPIXEL_ONE + SUBPIXEL_HALF)
+                 + c;
+        }
+    };
+
+    /**
+     * Настройка треугольника: выполняется один раз, после чего растеризатор
+     * только прибавляет step_x / step_y к значениям рёбер
+     */
+    struct TriangleSetup {
+        std::array<EdgeFunction, 3> edges; // w0 = BC, w1 = CA, w2 = AB
+        std::int64_t area;                 // всегда > 0
+        bool swapped;                      // b и c переставлены для положительной площади
+        int min_x, max_x, min_y, max_y;    // bounding box в пикселях, обрезанный по clip
+
+        /**
+         * @return std::nullopt, если треугольник вырожден, не попадает в clip,
+         *         или вершина не конечна / дальше MAX_COORDINATE (такие режет Clipper)
+         */
+        static std::optional<TriangleSetup> create(
+            const gmath::Vector2<float>& a,
+            const gmath::Vector2<float>& b,
+            const gmath::Vector2<float>& c,
+            const Rect& clip
+        ) {
+            // Сравнение в форме !(|v| <= max) ложно и для NaN
+            for (const gmath::Vector2<float>* v : {&a, &b, &c}) {
+                if (!(std::abs(v->x) <= MAX_COORDINATE) || !(std::abs(v->y) <= MAX_COORDINATE)) {
+                    return std::nullopt;
+                }
+            }
+
+            FixedPoint2 fa = to_fixed(a);
+            FixedPoint2 fb = to_fixed(b);
+            FixedPoint2 fc = to_fixed(c);
+
+            std::int64_t area = (fc.x - fa.x) * (fb.y - fa.y) - (fc.y - fa.y) * (fb.x - fa.x);
+            if (area == 0) {
+                return std::nullopt;
+            }
+
+            TriangleSetup setup{};
+            setup.swapped = area < 0;
+            if (setup.swapped) {
+                std::swap(fb, fc);
+                area = -area;
+            }
+            setup.area = area;
+
+            // Первый/последний пиксель, центр которого попадает в [min, max]
+            auto first_pixel = [](std::int64_t v) {
+                return static_cast<int>((v - SUBPIXEL_HALF + SUBPIXEL_ONE - 1) >> SUBPIXEL_BITS);
+            };
+            auto last_pixel = [](std::int64_t v) {
+                return static_cast<int>((v - SUBPIXEL_HALF) >> SUBPIXEL_BITS);
+            };
+
+            setup.min_x = std::max(first_pixel(std::min({fa.x, fb.x, fc.x})), clip.x0);
+            setup.max_x = std::min(last_pixel(std::max({fa.x, fb.x, fc.x})), clip.x1 - 1);
+            setup.min_y = std::max(first_pixel(std::min({fa.y, fb.y, fc.y})), clip.y0);
+            setup.max_y = std::min(last_pixel(std::max({fa.y, fb.y, fc.y})), clip.y1 - 1);
+
+            if (setup.min_x > setup.max_x || setup.min_y > setup.max_y) {
+                return std::nullopt;
+            }
+
+            setup.edges[0] = EdgeFunction(fb, fc);
+            setup.edges[1] = EdgeFunction(fc, fa);
+            setup.edges[2] = EdgeFunction(fa, fb);
+            return setup;
+        }
+
+        [[nodiscard]] Rect bounds() const {
+            return {min_x, min_y, max_x + 1, max_y + 1};
+        }
+
+        /**
+         * Тот же треугольник с bounding box, обрезанным по rect (например, по тайлу).
+         * Рёбра не пересчитываются
+         */
+        [[nodiscard]] std::optional<TriangleSetup> clipped(const Rect& rect) const {
+            const Rect box = bounds().intersect(rect);
+            if (box.empty()) {
+                return std::nullopt;
+            }
+            TriangleSetup result = *this;
+            result.min_x = box.x0;
+            result.max_x = box.x1 - 1;
+            result.min_y = box.y0;
+            result.max_y = box.y1 - 1;
+            return result;
+        }
+
+        /**
+         * Консервативная проверка: может ли треугольник покрыть хоть один пиксель rect.
+         * Для каждого ребра берётся угол rect, где его значение максимально
+         */
+        [[nodiscard]] bool may_cover(const Rect& rect) const {
+            for (const EdgeFunction& e : edges) {
+                const int x = e.a > 0 ? rect.x1 - 1 : rect.x0;
+                const int y = e.b > 0 ? rect.y1 - 1 : rect.y0;
+                if (e.at_pixel(x, y) < 0) {
+                    return false;
+                }
+            }
+            return true;
+        }
+    };
+}
+
+#endif //KGG_CPP_PROJECT_REPO_TRIANGLESETUP_H
@@ -0,0 +1,87 @@
+//
+// Created by shulz on 18.12.2025.
+//
+
+#ifndef KGG_CPP_PROJECT_REPO_VERTEXSTAGE_H
+#define KGG_CPP_PROJECT_REPO_VERTEXSTAGE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "Math/Matrix4.hpp"
+#include "Math/Vector3.hpp"
+#include "Math/Vector4.hpp"
+#include "Render/Clipper.h"
+#include "Render/ThreadPool.h"
+#include "Window/AlignedAllocator.hpp"
+
+class Mesh;
+
+namespace render {
+    /**
+     * Обработка вершин на CPU: позиции (SoA) -> clip space -> экран
+     *
+     * Потоки вершин обрабатываются блоками по BLOCK_SIZE, блоки — параллельно на ThreadPool:
+     * 1. gmath::batch::transform_points (SSE/AVX) в clip space
+     * 2. перспективное деление и отображение в viewport тем же кодом, что у Clipper,
+     *    поэтому треугольники с отсечением и без совпадают на стыках
+     * 3. флаг needs_clipping: вершина за near/far или за guard band
+     *
+     * Треугольник, у которого ни одна вершина не требует отсечения, можно сразу
+     * отдавать в растеризатор через screen(); иначе — clip() в Clipper
+     */
+    class VertexStage {
+        public:
+            using Stream = std::vector<float, AlignedAllocator<float>>;
+
+            static constexpr std::size_t BLOCK_SIZE = 4096;
+
+            explicit VertexStage(ThreadPool& pool);
+
+            void process(
+                std::span<const float> x,
+                std::span<const float> y,
+                std::span<const float> z,
+                const gmath::Matrix4<float>& mvp,
+                const Clipper& clipper
+            );
+
+            void process(const Mesh& mesh, const gmath::Matrix4<float>& mvp, const Clipper& clipper);
+
+            [[nodiscard]] std::size_t size() const { return m_screenX.size(); }
+
+            // x, y в пикселях, z — глубина [0, 1]; имеет смысл, если !needs_clipping(i)
+            [[nodiscard]] gmath::Vector3<float> screen(std::uint32_t i) const {
+                return {m_screenX[i], m_screenY[i], m_depth[i]};
+            }
+
+            [[nodiscard]] gmath::Vector4<float> clip(std::uint32_t i) const {
+                return {m_clipX[i], m_clipY[i], m_clipZ[i], m_clipW[i]};
+            }
+
+            [[nodiscard]] bool needs_clipping(std::uint32_t i) const { return m_needsClipping[i] != 0; }
+
+            [[nodiscard]] std::span<const float> screen_x() const { return m_screenX; }
+            [[nodiscard]] std::span<const float> screen_y() const { return m_screenY; }
+            [[nodiscard]] std::span<const float> depth() const { return m_depth; }
+            [[nodiscard]] std::span<const float> inv_w() const { return m_invW; }
+
+        private:
+            void process_block(
+                const float* x, const float* y, const float* z,
+                std::size_t begin, std::size_t end,
+                const gmath::Matrix4<float>& mvp,
+                const Clipper& clipper
+            );
+
+            ThreadPool& m_pool;
+
+            Stream m_clipX, m_clipY, m_clipZ, m_clipW;
+            Stream m_screenX, m_screenY, m_depth, m_invW;
+            std::vector<std::uint8_t> m_needsClipping;
+    };
+}
+
+#endif //KGG_CPP_PROJECT_REPO_VERTEXSTAGE_H
@@ -5,9 +5,175 @@
 #ifndef KGG_CPP_PROJECT_REPO_SHADER_H
 #define KGG_CPP_PROJECT_REPO_SHADER_H
 
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
 
-class shader {
-};
+#include "Math/Vector3.hpp"
+#include "Render/Mesh.h"
+#include "Window/Color.hpp"
 
+namespace render {
+    /**
+     * Шейдеры для растеризатора на CPU (ShaderPipeline)
+     *
+     * Шейдер — обычный тип, а не наследник с виртуальными функциями: ShaderPipeline
+     * параметризуется им как шаблоном, и fragment встраивается во внутренний цикл
+     * растеризации. Смена модели освещения — другой аргумент шаблона, без косвенных
+     * вызовов на пиксель. Требования:
+     *
+     *   static constexpr std::size_t VARYINGS;                     // число float-атрибутов вершины
+     *   void vertex(const Mesh&, std::uint32_t i, Varyings& out) const;
+     *   std::uint32_t fragment(const Varyings& in) const;          // RGBA, как Color::to_rgba32()
+     *
+     * и необязательно:
+     *
+     *   void primitive(std::uint32_t triangle, Varyings vertices[3]) const; // раз на треугольник, после vertex
+     *   static constexpr bool NEEDS_NORMALS = true;                // vertex читает mesh.normal()
+     *
+     * Varyings интерполируются перспективно-корректно (Interpolator)
+     */
+    template<std::size_t N>
+    using Varyings = std::array<float, N>;
 
-#endif //KGG_CPP_PROJECT_REPO_SHADER_H
\ No newline at end of file
+    template<class S>
+    concept Shader = requires(
+        const S& shader,
+        const Mesh& mesh,
+        std::uint32_t index,
+        Varyings<S::VARYINGS>& out,
+        const Varyings<S::VARYINGS>& in
+    ) {
+        { S::VARYINGS } -> std::convertible_to<std::size_t>;
+        shader.vertex(mesh, index, out);
+        { shader.fragment(in) } -> std::convertible_to<std::uint32_t>;
+    };
+
+    template<class S>
+    concept NeedsNormals = requires { requires S::NEEDS_NORMALS; };
+
+    template<class S>
+    concept HasPrimitiveStage = requires(const S& shader, std::uint32_t triangle, Varyings<S::VARYINGS>* vertices) {
+        shader.primitive(triangle, vertices);
+    };
+
+    /**
+     * Направленный свет и материал, в системе координат модели
+     * (те же координаты, что у позиций и нормалей Mesh)
+     */
+    struct Light {
+        gmath::Vector3f direction{0.0f, 0.0f, 1.0f}; // направление на источник, единичное
+        gmath::Vector3f eye{0.0f, 0.0f, 5.0f};       // положение наблюдателя, для блика
+        float ambient = 0.15f;
+        float diffuse = 0.85f;
+        float specular = 0.0f;
+        float shininess = 32.0f;
+
+        // ambient + диффузная (по Ламберту) составляющая
+        [[nodiscard]] float lambert(const gmath::Vector3f& normal) const {
+            return ambient + diffuse * std::max(normal.dot(direction), 0.0f);
+        }
+
+        // Блик по Блинну — Фонгу
+        [[nodiscard]] float blinn_phong(const gmath::Vector3f& normal, const gmath::Vector3f& position) const {
+            if (specular <= 0.0f) {
+                return 0.0f;
+            }
+            const gmath::Vector3f half = (direction + (eye - position).normalized()).normalized();
+            return specular * std::pow(std::max(normal.dot(half), 0.0f), shininess);
+        }
+    };
+
+    // base * diffuse + белый блик, с насыщением и округлением до ближайшего
+    inline std::uint32_t shade(const Color& base, float diffuse, float specular) {
+        auto channel = [&](std::uint8_t c) {
+            return static_cast<std::uint8_t>(
+                std::clamp(static_cast<float>(c) * diffuse + 255.0f * specular, 0.0f, 255.0f) + 0.5f
+            );
+        };
+        return Color(channel(base.r), channel(base.g), channel(base.b), base.a).to_rgba32();
+    }
+
+    /**
+     * Нормали треугольников меша (gmath::Normal::compute_face_normals) для FlatShader
+     */
+    std::vector<gmath::Vector3f> triangle_normals(const Mesh& mesh);
+
+    /**
+     * Плоское затенение: освещение считается один раз на треугольник по нормали грани
+     */
+    struct FlatShader {
+        static constexpr std::size_t VARYINGS = 1;
+
+        Color color;
+        Light light;
+        std::span<const gmath::Vector3f> face_normals; // triangle_normals(mesh)
+
+        void vertex(const Mesh&, std::uint32_t, Varyings<VARYINGS>&) const {}
+
+        void primitive(std::uint32_t triangle, Varyings<VARYINGS> vertices[3]) const {
+            const float intensity = light.lambert(face_normals[triangle]);
+            vertices[0][0] = vertices[1][0] = vertices[2][0] = intensity;
+        }
+
+        [[nodiscard]] std::uint32_t fragment(const Varyings<VARYINGS>& in) const {
+            return shade(color, in[0], 0.0f);
+        }
+    };
+
+    /**
+     * Затенение по Гуро: освещение в вершинах по нормалям меша, интерполируется яркость
+     */
+    struct GouraudShader {
+        static constexpr std::size_t VARYINGS = 2; // диффузная составляющая, блик
+        static constexpr bool NEEDS_NORMALS = true;
+
+        Color color;
+        Light light;
+
+        void vertex(const Mesh& mesh, std::uint32_t i, Varyings<VARYINGS>& out) const {
+            const gmath::Vector3f normal = mesh.normal(i);
+            out[0] = light.lambert(normal);
+            out[1] = light.blinn_phong(normal, mesh.position(i));
+        }
+
+        [[nodiscard]] std::uint32_t fragment(const Varyings<VARYINGS>& in) const {
+            return shade(color, in[0], in[1]);
+        }
+    };
+
+    /**
+     * Затенение по Фонгу: интерполируются нормаль и позиция, освещение — в каждом пикселе
+     */
+    struct PhongShader {
+        static constexpr std::size_t VARYINGS = 6; // нормаль, позиция
+        static constexpr bool NEEDS_NORMALS = true;
+
+        Color color;
+        Light light;
+
+        void vertex(const Mesh& mesh, std::uint32_t i, Varyings<VARYINGS>& out) const {
+            const gmath::Vector3f normal = mesh.normal(i);
+            const gmath::Vector3f position = mesh.position(i);
+            out = {normal.x, normal.y, normal.z, position.x, position.y, position.z};
+        }
+
+        [[nodiscard]] std::uint32_t fragment(const Varyings<VARYINGS>& in) const {
+            const gmath::Vector3f normal = gmath::Vector3f(in[0], in[1], in[2]).normalized();
+            const gmath::Vector3f position(in[3], in[4], in[5]);
+            return shade(color, light.lambert(normal), light.blinn_phong(normal, position));
+        }
+    };
+
+    static_assert(Shader<FlatShader> && HasPrimitiveStage<FlatShader> && !NeedsNormals<FlatShader>);
+    static_assert(Shader<GouraudShader> && !HasPrimitiveStage<GouraudShader> && NeedsNormals<GouraudShader>);
+    static_assert(Shader<PhongShader> && NeedsNormals<PhongShader>);
+}
+
+
+#endif //KGG_CPP_PROJECT_REPO_SHADER_H
@@ -4,13 +4,47 @@
 
 #ifndef KGG_CPP_PROJECT_REPO_CAMERA_H
 #define KGG_CPP_PROJECT_REPO_CAMERA_H
-#include <Math/Vector3.hpp>
 
+#include <numbers>
+
+#include <Math/Matrix4.hpp>
+#include <Math/Vector3.hpp>
 
+/**
+ * Камера: положение, точка взгляда и параметры перспективы.
+ * Всё constexpr — для камеры с известными параметрами матрицы
+ * вида и проекции собираются на этапе компиляции
+ */
 class Camera {
     public:
-    static gmath::Vector3d look_direction_vector(gmath::Vector3d target, gmath::Vector3d eye);
+    gmath::Vector3f eye{0.0f, 0.0f, 0.0f};
+    gmath::Vector3f target{0.0f, 0.0f, -1.0f};
+    gmath::Vector3f up{0.0f, 1.0f, 0.0f};
+
+    float fov_y = std::numbers::pi_v<float> / 3.0f; // вертикальный угол обзора, радианы
+    float aspect = 1.0f;                            // ширина / высота
+    float z_near = 0.1f;
+    float z_far = 100.0f;
+
+    template<gmath::is_float_double T>
+    static constexpr gmath::Vector3<T> look_direction_vector(gmath::Vector3<T> target, gmath::Vector3<T> eye) {
+        gmath::Vector3<T> z = target - eye;
+        return z;
+    }
+
+    [[nodiscard]] constexpr gmath::Matrix4f view_matrix() const {
+        return gmath::Matrix4f::look_at(eye, target, up);
+    }
+
+    [[nodiscard]] constexpr gmath::Matrix4f projection_matrix() const {
+        return gmath::Matrix4f::perspective(fov_y, aspect, z_near, z_far);
+    }
+
+    // projection * view: мировые координаты -> clip space
+    [[nodiscard]] constexpr gmath::Matrix4f view_projection() const {
+        return projection_matrix() * view_matrix();
+    }
 };
 
 
-#endif //KGG_CPP_PROJECT_REPO_CAMERA_H
\ No newline at end of file
+#endif //KGG_CPP_PROJECT_REPO_CAMERA_H
@@ -0,0 +1,45 @@
+//
+// Created by shulz on 18.12.2025.
+//
+
+#ifndef KGG_CPP_PROJECT_REPO_ALIGNEDALLOCATOR_HPP
+#define KGG_CPP_PROJECT_REPO_ALIGNEDALLOCATOR_HPP
+
+#include <cstddef>
+#include <new>
+
+namespace render {
+    /**
+     * Аллокатор для std::vector с выравниванием начала буфера на Alignment байт
+     * (по умолчанию — линия кэша, хватает и для AVX-загрузок)
+     */
+    template<typename T, std::size_t Alignment = 64>
+    struct AlignedAllocator {
+        using value_type = T;
+
+        template<typename U>
+        struct rebind {
+            using other = AlignedAllocator<U, Alignment>;
+        };
+
+        AlignedAllocator() noexcept = default;
+
+        template<typename U>
+        AlignedAllocator(const AlignedAllocator<U, Alignment>&) noexcept {}
+
+        [[nodiscard]] T* allocate(std::size_t n) {
+            return static_cast<T*>(::operator new(n * sizeof(T), std::align_val_t{Alignment}));
+        }
+
+        void deallocate(T* p, std::size_t) noexcept {
+            ::operator delete(p, std::align_val_t{Alignment});
+        }
+
+        template<typename U>
+        bool operator==(const AlignedAllocator<U, Alignment>&) const noexcept {
+            return true;
+        }
+    };
+}
+
+#endif //KGG_CPP_PROJECT_REPO_ALIGNEDALLOCATOR_HPP
@@ -5,6 +5,8 @@
 #ifndef KGG_CPP_PROJECT_REPO_COLOR_HPP
 #define KGG_CPP_PROJECT_REPO_COLOR_HPP
 
+#include <cstdint>
+
 namespace render {
     struct Color {
         std::uint8_t r, g, b, a;
@@ -16,6 +18,14 @@ namespace render {
             std::uint8_t a = 255
         ) : r(r), g(g), b(b), a(a) {}
 
+        // Пиксель одним словом: в памяти (little-endian) байты идут как R, G, B, A
+        [[nodiscard]] constexpr std::uint32_t to_rgba32() const {
+            return static_cast<std::uint32_t>(r)
+                 | static_cast<std::uint32_t>(g) << 8
+                 | static_cast<std::uint32_t>(b) << 16
+                 | static_cast<std::uint32_t>(a) << 24;
+        }
+
         static constexpr Color black() { return Color(0, 0, 0, 255); }
         static constexpr Color white() { return Color(255, 255, 255, 255); }
         static constexpr Color red() { return Color(255, 0, 0, 255); }
@@ -8,23 +8,115 @@
 
 #include <cstdint>
 #include <vector>
+#include <Window/AlignedAllocator.hpp>
 #include <Window/Color.hpp>
+#include <Render/Rect.h>
 
 namespace render {
     class Framebuffer {
         public:
+            // Размер тайла для отслеживания изменённых областей (совпадает с TiledRenderer)
+            static constexpr int TILE_SIZE = 64;
+            // Блок иерархического z-буфера: для каждого хранятся границы глубины
+            static constexpr int DEPTH_BLOCK = 8;
+
             Framebuffer(uint32_t  width, uint32_t  height);
 
+            /**
+             * Заливка цветом. Если цвет тот же, что и при прошлой очистке,
+             * перезаписываются только тайлы, изменённые с тех пор
+             */
             void clear(const Color& color);
+            // Заливка всего буфера независимо от отметок
+            void clear_full(const Color& color);
             void set_pixel(int  x, int y, const Color& color);
 
+            // ---------- Запись без проверок ----------
+            // Для вызывающих, которые уже обрезали координаты (растеризатор).
+            // Тайлы при этом не отмечаются — нужен mark_dirty
+
+            void set_pixel_unchecked(int x, int y, std::uint32_t rgba) {
+                get_row(static_cast<uint32_t>(y))[x] = rgba;
+            }
+
+            // Горизонтальный отрезок [x0, x1) строки y
+            void fill_span(int y, int x0, int x1, std::uint32_t rgba);
+
+            // Начало строки y; строки идут подряд через get_stride() пикселей
+            [[nodiscard]] std::uint32_t* get_row(uint32_t y) {
+                return m_colorBuffer.data() + static_cast<size_t>(y) * m_width;
+            }
+
+            [[nodiscard]] const std::uint32_t* get_row(uint32_t y) const {
+                return m_colorBuffer.data() + static_cast<size_t>(y) * m_width;
+            }
+
+            /**
+             * Отметить область как изменённую. Вызывается всеми, кто пишет через get_row,
+             * иначе ленивый clear её не очистит. Тайлы, целиком лежащие в разных rect,
+             * можно отмечать из разных потоков
+             */
+            void mark_dirty(const Rect& rect);
+            [[nodiscard]] bool is_tile_dirty(int tile_x, int tile_y) const;
+            [[nodiscard]] int get_tiles_x() const;
+            [[nodiscard]] int get_tiles_y() const;
+
+            // Цвет последней очистки: вне отмеченных тайлов буфер залит им.
+            // Пока clear не вызывался, has_clear_color() == false
+            [[nodiscard]] bool has_clear_color() const;
+            [[nodiscard]] std::uint32_t get_clear_color() const;
+
+            // ---------- Буфер глубины ----------
+            // float на пиксель, меньше — ближе, тест глубины LESS
+
+            void clear_depth(float depth = 1.0f);
+
+            [[nodiscard]] float* get_depth_row(uint32_t y) {
+                return m_depthBuffer.data() + static_cast<size_t>(y) * m_width;
+            }
+
+            [[nodiscard]] const float* get_depth_row(uint32_t y) const {
+                return m_depthBuffer.data() + static_cast<size_t>(y) * m_width;
+            }
+
+            /**
+             * Верхняя граница глубины в блоке DEPTH_BLOCK x DEPTH_BLOCK.
+             * Если треугольник целиком не ближе неё, в блоке он не виден.
+             * После записей граница уточняется лениво, при следующем запросе
+             */
+            [[nodiscard]] float block_max_depth(int block_x, int block_y);
+
+            // Нижняя граница: треугольник, целиком ближе неё, проходит тест в каждом пикселе
+            [[nodiscard]] float block_min_depth(int block_x, int block_y) const;
+
+            // Вызывается после записи в блок глубин не меньше min_depth
+            void note_depth_write(int block_x, int block_y, float min_depth);
+
+            // Байты RGBA подряд — формат sf::Texture::update
             [[nodiscard]] const uint8_t* get_data() const;
+            [[nodiscard]] const std::uint32_t* get_pixels() const;
+            // Шаг между строками в пикселях
+            [[nodiscard]] size_t get_stride() const;
             [[nodiscard]] uint32_t  get_width() const;
             [[nodiscard]] uint32_t  get_height() const;
 
         private:
+            void fill_rect(const Rect& rect, std::uint32_t rgba);
+
             uint32_t m_width, m_height;
-            std::vector<std::uint8_t> m_colorBuffer; // RGBA
+            // Пиксель — одно слово Color::to_rgba32(), начало буфера выровнено на 64 байта
+            std::vector<std::uint32_t, AlignedAllocator<std::uint32_t>> m_colorBuffer;
+
+            int m_tiles_x, m_tiles_y;
+            std::vector<std::uint8_t> m_dirtyTiles; // байт на тайл, чтобы потоки не делили слова
+            std::vector<float, AlignedAllocator<float>> m_depthBuffer;
+            int m_blocks_x, m_blocks_y;
+            std::vector<float> m_blockMinDepth;
+            std::vector<float> m_blockMaxDepth;
+            std::vector<std::uint8_t> m_blockStale; // m_blockMaxDepth надо пересчитать
+
+            bool m_hasClearColor = false;
+            std::uint32_t m_clearColor = 0;
     };
 }
 
@@ -0,0 +1,58 @@
+//
+// Created by shulz on 18.12.2025.
+//
+
+#ifndef KGG_CPP_PROJECT_REPO_HEADLESS_H
+#define KGG_CPP_PROJECT_REPO_HEADLESS_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+/**
+ * Рендер без окна: тот же Framebuffer / ShaderPipeline, без SFML и без
+ * ограничения частоты кадров. Для пакетного рендера на серверах без дисплея
+ * и для замеров пропускной способности
+ *
+ *   app --headless --model m.obj [--shader flat|gouraud|phong] [--size 800x600]
+ *       [--frames N] [--spin DEG] [--threads N] [--output PATH] [--profile TRACE]
+ *
+ * PATH:
+ *   frame_####.png / .ppm — кадр на файл, # заменяются номером кадра
+ *                           (без # при N > 1 номер дописывается перед расширением)
+ *   out.raw или -         — все кадры подряд в один поток RGBA (- — stdout)
+ *   не задан              — только рендер, для замера
+ *
+ * TRACE — файл трассы Chrome Trace Event (chrome://tracing, Perfetto) с этапами
+ * и счётчиками profile::Profiler по всем кадрам; итоги этапов печатаются в stderr
+ *
+ * Статистика (кадры, время рендера и записи) печатается в stderr
+ */
+struct HeadlessOptions {
+    std::string model;
+    std::string shader = "phong";
+    std::uint32_t width = 800;
+    std::uint32_t height = 600;
+    int frames = 1;
+    float spin = 0.0f;        // поворот камеры вокруг модели за кадр, градусы
+    std::size_t threads = 0;  // 0 — ThreadPool::default_worker_count()
+    std::string output;
+    std::string profile;      // пусто — без профилирования
+
+    // Есть ли среди аргументов --headless
+    static bool requested(int argc, const char* const* argv);
+
+    // Бросает std::invalid_argument при неизвестном или неверном аргументе
+    static HeadlessOptions parse(int argc, const char* const* argv);
+
+    // Путь кадра frame для вывода в файлы
+    [[nodiscard]] std::string frame_path(int frame) const;
+};
+
+class Headless {
+public:
+    // Код возврата для main
+    static int run(const HeadlessOptions& options);
+};
+
+#endif //KGG_CPP_PROJECT_REPO_HEADLESS_H
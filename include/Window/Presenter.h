@@ -0,0 +1,97 @@
+//
+// Created by shulz on 18.12.2025.
+//
+
+#ifndef KGG_CPP_PROJECT_REPO_PRESENTER_H
+#define KGG_CPP_PROJECT_REPO_PRESENTER_H
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <vector>
+
+#include "Render/Rect.h"
+#include "Window/Framebuffer.h"
+
+namespace render {
+    /**
+     * Показ кадров с двойной или тройной буферизацией
+     *
+     * - рендер (любой поток): acquire() -> clear + рисование -> submit()
+     * - показ (поток с GL-контекстом): present(upload) берёт последний готовый кадр
+     *   и передаёт в upload только изменившиеся прямоугольники
+     *
+     * Пока показ загружает кадр N в текстуру, рендер пишет кадр N + 1 в другой буфер,
+     * загрузка и растеризация друг друга не ждут. Готовый, но ещё не показанный кадр
+     * заменяется более новым (mailbox) — показ всегда получает свежий кадр
+     *
+     * Изменившаяся область: каждый кадр начинается с Framebuffer::clear, поэтому вне
+     * отмеченных тайлов он залит цветом очистки. При том же цвете очистки новый кадр
+     * отличается от показанного только в тайлах, отмеченных в одном из двух кадров.
+     * Если цвет другой или очистки не было — загружается весь кадр
+     */
+    class Presenter {
+        public:
+            // rect — область кадра; пиксели строки y начинаются с frame.get_row(y) + rect.x0
+            using Upload = std::function<void(const Framebuffer& frame, const Rect& rect)>;
+
+            Presenter(uint32_t width, uint32_t height, std::size_t buffer_count = 3);
+
+            Presenter(const Presenter&) = delete;
+            Presenter& operator=(const Presenter&) = delete;
+
+            // ---------- Рендер ----------
+
+            /**
+             * Свободный буфер для следующего кадра. Содержимое — один из прошлых кадров,
+             * его нужно очистить. С двумя буферами ждёт, пока показ освободит буфер
+             */
+            [[nodiscard]] Framebuffer& acquire();
+
+            // Кадр готов; предыдущий готовый и не показанный кадр отбрасывается
+            void submit(Framebuffer& frame);
+
+            // ---------- Показ ----------
+
+            /**
+             * Загрузить последний готовый кадр
+             * @return false, если нового кадра нет (upload не вызывался)
+             */
+            bool present(const Upload& upload);
+
+            // Пикселей, переданных в upload при последнем present
+            [[nodiscard]] std::size_t last_upload_pixels() const;
+            [[nodiscard]] std::size_t buffer_count() const;
+            [[nodiscard]] uint32_t get_width() const;
+            [[nodiscard]] uint32_t get_height() const;
+
+        private:
+            enum class State : std::uint8_t { free, rendering, ready, presenting };
+
+            static constexpr std::size_t NONE = static_cast<std::size_t>(-1);
+
+            [[nodiscard]] std::size_t index_of(const Framebuffer& frame) const;
+            void collect_rects(const Framebuffer& frame);
+
+            uint32_t m_width, m_height;
+            std::vector<Framebuffer> m_buffers;
+
+            std::mutex m_mutex;
+            std::condition_variable m_freed;
+            std::vector<State> m_states;
+            std::size_t m_ready = NONE;
+
+            // Только поток показа: что сейчас в текстуре
+            std::vector<std::uint8_t> m_shownTiles;
+            std::uint32_t m_shownClearColor = 0;
+            bool m_hasShown = false;
+
+            std::vector<std::uint8_t> m_uploadTiles;
+            std::vector<Rect> m_rects;
+            std::size_t m_lastUploadPixels = 0;
+    };
+}
+
+#endif //KGG_CPP_PROJECT_REPO_PRESENTER_H
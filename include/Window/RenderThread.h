@@ -0,0 +1,177 @@
+//
+// Created by shulz on 18.12.2025.
+//
+
+#ifndef KGG_CPP_PROJECT_REPO_RENDERTHREAD_H
+#define KGG_CPP_PROJECT_REPO_RENDERTHREAD_H
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+
+#include "Window/Framebuffer.h"
+#include "Window/Presenter.h"
+
+namespace render {
+    /**
+     * Отдельный поток рендера: производитель кадров для Presenter
+     *
+     * - поток UI: обрабатывает ввод, собирает снимок сцены (Snapshot — копия всего,
+     *   что нужно для кадра) и кладёт его push(); push не ждёт рендера
+     * - поток рендера: берёт снимки из очереди по порядку, рисует каждый
+     *   в буфер presenter.acquire() и отдаёт presenter.submit()
+     * - поток UI показывает готовые кадры presenter.present()
+     *
+     * Снимок — значение, а не ссылка на живую сцену: UI меняет сцену, пока
+     * рендер рисует предыдущее состояние, без общих данных и блокировок.
+     * Очередь ограничена: если рендер отстаёт, самый старый снимок отбрасывается,
+     * и задержка от ввода до кадра не растёт
+     *
+     * Исключение из render останавливает поток и пробрасывается из push / wait_idle.
+     * С двумя буферами Presenter рендер ждёт present(): UI должен показывать кадры
+     */
+    template<class Snapshot>
+    class RenderThread {
+        public:
+            using Render = std::function<void(const Snapshot& snapshot, Framebuffer& target)>;
+
+            RenderThread(Presenter& presenter, Render render, std::size_t queue_capacity = 2)
+                : m_presenter(presenter), m_render(std::move(render)), m_capacity(queue_capacity)
+            {
+                if (queue_capacity == 0) {
+                    throw std::invalid_argument("RenderThread queue capacity must be positive");
+                }
+                m_thread = std::thread([this] { loop(); });
+            }
+
+            ~RenderThread() {
+                {
+                    std::lock_guard lock(m_mutex);
+                    m_stop = true;
+                }
+                m_wake.notify_all();
+                if (m_thread.joinable()) {
+                    m_thread.join();
+                }
+            }
+
+            RenderThread(const RenderThread&) = delete;
+            RenderThread& operator=(const RenderThread&) = delete;
+
+            /**
+             * Поставить снимок в очередь
+             * @return false, если очередь была полна и самый старый снимок отброшен
+             */
+            bool push(Snapshot snapshot) {
+                bool dropped = false;
+                {
+                    std::lock_guard lock(m_mutex);
+                    rethrow_failure();
+                    if (m_queue.size() >= m_capacity) {
+                        m_queue.pop_front();
+                        ++m_dropped;
+                        dropped = true;
+                    }
+                    m_queue.push_back(std::move(snapshot));
+                }
+                m_wake.notify_one();
+                return !dropped;
+            }
+
+            // Дождаться, пока очередь опустеет и текущий кадр будет отдан Presenter
+            void wait_idle() {
+                std::unique_lock lock(m_mutex);
+                m_idle.wait(lock, [&] { return (m_queue.empty() && !m_busy) || m_failure; });
+                rethrow_failure();
+            }
+
+            [[nodiscard]] std::size_t frames_rendered() const {
+                std::lock_guard lock(m_mutex);
+                return m_rendered;
+            }
+
+            [[nodiscard]] std::size_t snapshots_dropped() const {
+                std::lock_guard lock(m_mutex);
+                return m_dropped;
+            }
+
+            // Время render последнего кадра, мс
+            [[nodiscard]] double last_frame_ms() const {
+                std::lock_guard lock(m_mutex);
+                return m_lastFrameMs;
+            }
+
+        private:
+            void loop() {
+                std::unique_lock lock(m_mutex);
+                while (true) {
+                    m_wake.wait(lock, [&] { return m_stop || !m_queue.empty(); });
+                    if (m_stop) {
+                        return;
+                    }
+                    Snapshot snapshot = std::move(m_queue.front());
+                    m_queue.pop_front();
+                    m_busy = true;
+                    lock.unlock();
+
+                    const auto start = std::chrono::steady_clock::now();
+                    std::exception_ptr failure;
+                    try {
+                        Framebuffer& target = m_presenter.acquire();
+                        m_render(snapshot, target);
+                        m_presenter.submit(target);
+                    } catch (...) {
+                        failure = std::current_exception();
+                    }
+                    const auto end = std::chrono::steady_clock::now();
+
+                    lock.lock();
+                    m_busy = false;
+                    if (failure) {
+                        m_failure = failure;
+                        m_idle.notify_all();
+                        return;
+                    }
+                    ++m_rendered;
+                    m_lastFrameMs = std::chrono::duration<double, std::milli>(end - start).count();
+                    if (m_queue.empty()) {
+                        m_idle.notify_all();
+                    }
+                }
+            }
+
+            // Под m_mutex
+            void rethrow_failure() {
+                if (m_failure) {
+                    std::rethrow_exception(m_failure);
+                }
+            }
+
+            Presenter& m_presenter;
+            Render m_render;
+            std::size_t m_capacity;
+
+            mutable std::mutex m_mutex;
+            std::condition_variable m_wake;
+            std::condition_variable m_idle;
+            std::deque<Snapshot> m_queue;
+            bool m_busy = false;
+            bool m_stop = false;
+            std::exception_ptr m_failure;
+
+            std::size_t m_rendered = 0;
+            std::size_t m_dropped = 0;
+            double m_lastFrameMs = 0.0;
+
+            std::thread m_thread; // последним: запускается, когда остальные поля готовы
+    };
+}
+
+#endif //KGG_CPP_PROJECT_REPO_RENDERTHREAD_H
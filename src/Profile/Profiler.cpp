@@ -0,0 +1,272 @@
+//
+// Created by shulz on 18.12.2025.
+//
+
+#include "Profile/Profiler.h"
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <stdexcept>
+
+namespace profile {
+    const char* name(Stage stage) {
+        switch (stage) {
+            case Stage::frame: return "frame";
+            case Stage::clear: return "clear";
+            case Stage::transform: return "transform";
+            case Stage::binning: return "binning";
+            case Stage::raster: return "raster";
+            case Stage::tile: return "tile";
+            case Stage::upload: return "upload";
+            case Stage::COUNT: break;
+        }
+        return "unknown";
+    }
+
+    const char* name(Counter counter) {
+        switch (counter) {
+            case Counter::triangles_submitted: return "triangles_submitted";
+            case Counter::triangles_culled: return "triangles_culled";
+            case Counter::triangles_rasterized: return "triangles_rasterized";
+            case Counter::pixels_shaded: return "pixels_shaded";
+            case Counter::COUNT: break;
+        }
+        return "unknown";
+    }
+
+    // ---------- EventRing ----------
+
+    bool EventRing::push(const Event& event) {
+        const std::size_t head = m_head.load(std::memory_order_relaxed);
+        if (head - m_tail.load(std::memory_order_acquire) >= CAPACITY) {
+            m_dropped.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        m_events[head & (CAPACITY - 1)] = event;
+        m_head.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    bool EventRing::pop(Event& event) {
+        const std::size_t tail = m_tail.load(std::memory_order_relaxed);
+        if (tail == m_head.load(std::memory_order_acquire)) {
+            return false;
+        }
+        event = m_events[tail & (CAPACITY - 1)];
+        m_tail.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    // ---------- Profiler ----------
+
+    struct Profiler::ThreadState {
+        EventRing ring;
+        // Накопленные значения; пишет только поток-владелец, поэтому без RMW
+        std::array<std::atomic<std::uint64_t>, COUNTER_COUNT> counters{};
+        // Только сборщик: значения counters на прошлом collect
+        std::array<std::uint64_t, COUNTER_COUNT> collected{};
+        // Поток завершился, состояние можно отдать новому потоку
+        std::atomic<bool> retired{false};
+        std::uint32_t index = 0;
+    };
+
+    namespace {
+        struct LocalHandle {
+            void* state = nullptr;
+            std::atomic<bool>* retired = nullptr;
+
+            ~LocalHandle() {
+                if (retired) {
+                    retired->store(true, std::memory_order_release);
+                }
+            }
+        };
+
+        thread_local LocalHandle t_local;
+    }
+
+    Profiler& Profiler::instance() {
+        static Profiler profiler;
+        return profiler;
+    }
+
+    void Profiler::set_enabled(bool enabled) {
+        m_enabled.store(enabled, std::memory_order_relaxed);
+    }
+
+    Profiler::ThreadState& Profiler::local() {
+        if (t_local.state) {
+            return *static_cast<ThreadState*>(t_local.state);
+        }
+
+        std::lock_guard lock(m_registryMutex);
+        ThreadState* state = nullptr;
+        for (const auto& existing : m_threads) {
+            if (existing->retired.load(std::memory_order_acquire)) {
+                existing->retired.store(false, std::memory_order_relaxed);
+                state = existing.get();
+                break;
+            }
+        }
+        if (!state) {
+            m_threads.push_back(std::make_unique<ThreadState>());
+            state = m_threads.back().get();
+            state->index = static_cast<std::uint32_t>(m_threads.size() - 1);
+        }
+        t_local.state = state;
+        t_local.retired = &state->retired;
+        return *state;
+    }
+
+    void Profiler::record(Stage stage, std::int64_t start_ns, std::int64_t end_ns) {
+        ThreadState& state = local();
+        state.ring.push({start_ns, end_ns - start_ns, state.index, stage});
+    }
+
+    void Profiler::count(Counter counter, std::uint64_t value) {
+        std::atomic<std::uint64_t>& total = local().counters[static_cast<std::size_t>(counter)];
+        total.store(total.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+    }
+
+    FrameStats Profiler::collect() {
+        FrameStats stats;
+        {
+            std::lock_guard lock(m_registryMutex);
+            for (const auto& state : m_threads) {
+                Event event{};
+                while (state->ring.pop(event)) {
+                    stats.stage_ms[static_cast<std::size_t>(event.stage)] += static_cast<double>(event.duration_ns) * 1e-6;
+                    if (m_capturing && m_capture.size() < MAX_CAPTURE) {
+                        m_capture.push_back(event);
+                    }
+                }
+                for (std::size_t i = 0; i < COUNTER_COUNT; ++i) {
+                    const std::uint64_t total = state->counters[i].load(std::memory_order_relaxed);
+                    stats.counters[i] += total - state->collected[i];
+                    state->collected[i] = total;
+                }
+            }
+        }
+
+        if (m_history.size() < HISTORY) {
+            m_history.push_back(stats);
+        } else {
+            m_history[m_historyNext] = stats;
+        }
+        m_historyNext = (m_historyNext + 1) % HISTORY;
+        m_last = stats;
+
+        if (m_capturing) {
+            m_captureCounters.push_back({now_ns(), stats.counters});
+        }
+        return stats;
+    }
+
+    void Profiler::stage_history(Stage stage, std::vector<float>& out) const {
+        out.clear();
+        const std::size_t first = m_history.size() < HISTORY ? 0 : m_historyNext;
+        for (std::size_t i = 0; i < m_history.size(); ++i) {
+            out.push_back(static_cast<float>(
+                m_history[(first + i) % m_history.size()].stage_ms[static_cast<std::size_t>(stage)]));
+        }
+    }
+
+    void Profiler::counter_history(Counter counter, std::vector<float>& out) const {
+        out.clear();
+        const std::size_t first = m_history.size() < HISTORY ? 0 : m_historyNext;
+        for (std::size_t i = 0; i < m_history.size(); ++i) {
+            out.push_back(static_cast<float>(
+                m_history[(first + i) % m_history.size()].counters[static_cast<std::size_t>(counter)]));
+        }
+    }
+
+    const FrameStats& Profiler::last() const {
+        return m_last;
+    }
+
+    void Profiler::start_capture() {
+        m_capture.clear();
+        m_captureCounters.clear();
+        m_capturing = true;
+    }
+
+    void Profiler::stop_capture() {
+        m_capturing = false;
+    }
+
+    void Profiler::write_chrome_trace(std::ostream& out) const {
+        std::int64_t origin = 0;
+        std::uint32_t threads = 0;
+        if (!m_capture.empty()) {
+            origin = m_capture.front().start_ns;
+        }
+        for (const Event& event : m_capture) {
+            origin = std::min(origin, event.start_ns);
+            threads = std::max(threads, event.thread + 1);
+        }
+        // Микросекунды от начала записи, с точностью до наносекунды
+        auto us = [&](std::int64_t ns) { return static_cast<double>(ns - origin) * 1e-3; };
+
+        const auto flags = out.flags();
+        out << std::fixed << std::setprecision(3);
+        out << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+        bool first = true;
+        auto separator = [&] {
+            if (!first) {
+                out << ",";
+            }
+            first = false;
+            out << "\n";
+        };
+
+        for (std::uint32_t thread = 0; thread < threads; ++thread) {
+            separator();
+            out << R"({"name":"thread_name","ph":"M","pid":1,"tid":)" << thread
+                << R"(,"args":{"name":"thread )" << thread << "\"}}";
+        }
+        for (const Event& event : m_capture) {
+            separator();
+            out << R"({"name":")" << name(event.stage) << R"(","cat":"render","ph":"X","pid":1,"tid":)"
+                << event.thread << ",\"ts\":" << us(event.start_ns)
+                << ",\"dur\":" << static_cast<double>(event.duration_ns) * 1e-3 << "}";
+        }
+        for (const CounterSample& sample : m_captureCounters) {
+            const double ts = us(std::max(sample.time_ns, origin));
+            separator();
+            out << R"({"name":"triangles","ph":"C","pid":1,"ts":)" << ts << R"(,"args":{)"
+                << R"("submitted":)" << sample.counters[static_cast<std::size_t>(Counter::triangles_submitted)]
+                << R"(,"culled":)" << sample.counters[static_cast<std::size_t>(Counter::triangles_culled)]
+                << R"(,"rasterized":)" << sample.counters[static_cast<std::size_t>(Counter::triangles_rasterized)]
+                << "}}";
+            separator();
+            out << R"({"name":"pixels_shaded","ph":"C","pid":1,"ts":)" << ts << R"(,"args":{"pixels":)"
+                << sample.counters[static_cast<std::size_t>(Counter::pixels_shaded)] << "}}";
+        }
+        out << "\n]}\n";
+        out.flags(flags);
+    }
+
+    void Profiler::write_chrome_trace(const std::string& path) const {
+        std::ofstream out(path, std::ios::trunc);
+        write_chrome_trace(out);
+        if (!out) {
+            throw std::runtime_error("Cannot write trace: " + path);
+        }
+    }
+
+    std::uint64_t Profiler::dropped_events() const {
+        std::lock_guard lock(m_registryMutex);
+        std::uint64_t dropped = 0;
+        for (const auto& state : m_threads) {
+            dropped += state->ring.dropped();
+        }
+        return dropped;
+    }
+
+    std::int64_t Profiler::now_ns() {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+}
@@ -0,0 +1,198 @@
+//
+// Created by lunarimoonlin on 12/14/25.
+//
+
+#include "ReadWrite/ImageWriter.h"
+
+#include <algorithm>
+#include <array>
+#include <cctype>
+#include <cstdint>
+#include <fstream>
+#include <stdexcept>
+#include <vector>
+
+#include "Window/Framebuffer.h"
+
+namespace io {
+    namespace {
+        constexpr std::array<std::uint32_t, 256> make_crc_table() {
+            std::array<std::uint32_t, 256> table{};
+            for (std::uint32_t n = 0; n < 256; ++n) {
+                std::uint32_t c = n;
+                for (int k = 0; k < 8; ++k) {
+                    c = (c & 1) ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+                }
+                table[n] = c;
+            }
+            return table;
+        }
+
+        constexpr auto CRC_TABLE = make_crc_table();
+
+        std::uint32_t crc32(std::uint32_t crc, const std::uint8_t* data, std::size_t size) {
+            crc = ~crc;
+            for (std::size_t i = 0; i < size; ++i) {
+                crc = CRC_TABLE[(crc ^ data[i]) & 0xFF] ^ (crc >> 8);
+            }
+            return ~crc;
+        }
+
+        std::uint32_t adler32(const std::uint8_t* data, std::size_t size) {
+            constexpr std::uint32_t MOD = 65521;
+            // 5552 — наибольшая длина, при которой сумма не переполняет 32 бита
+            std::uint32_t a = 1, b = 0;
+            while (size > 0) {
+                const std::size_t chunk = std::min<std::size_t>(size, 5552);
+                for (std::size_t i = 0; i < chunk; ++i) {
+                    a += data[i];
+                    b += a;
+                }
+                a %= MOD;
+                b %= MOD;
+                data += chunk;
+                size -= chunk;
+            }
+            return (b << 16) | a;
+        }
+
+        void put_u32_be(std::vector<std::uint8_t>& out, std::uint32_t value) {
+            out.push_back(static_cast<std::uint8_t>(value >> 24));
+            out.push_back(static_cast<std::uint8_t>(value >> 16));
+            out.push_back(static_cast<std::uint8_t>(value >> 8));
+            out.push_back(static_cast<std::uint8_t>(value));
+        }
+
+        void write_chunk(std::ostream& out, const char type[4], const std::vector<std::uint8_t>& data) {
+            std::vector<std::uint8_t> head;
+            put_u32_be(head, static_cast<std::uint32_t>(data.size()));
+            head.insert(head.end(), type, type + 4);
+
+            std::uint32_t crc = crc32(0, head.data() + 4, 4);
+            crc = crc32(crc, data.data(), data.size());
+            std::vector<std::uint8_t> tail;
+            put_u32_be(tail, crc);
+
+            out.write(reinterpret_cast<const char*>(head.data()), static_cast<std::streamsize>(head.size()));
+            out.write(reinterpret_cast<const char*>(data.data()), static_cast<std::streamsize>(data.size()));
+            out.write(reinterpret_cast<const char*>(tail.data()), static_cast<std::streamsize>(tail.size()));
+        }
+    }
+
+    ImageFormat format_for_path(const std::string& path) {
+        auto ends_with = [&](const char* suffix) {
+            const std::string s(suffix);
+            if (path.size() < s.size()) {
+                return false;
+            }
+            return std::equal(s.rbegin(), s.rend(), path.rbegin(), [](char a, char b) {
+                return a == std::tolower(static_cast<unsigned char>(b));
+            });
+        };
+        if (ends_with(".ppm")) {
+            return ImageFormat::ppm;
+        }
+        if (ends_with(".png")) {
+            return ImageFormat::png;
+        }
+        return ImageFormat::raw;
+    }
+
+    void write_ppm(std::ostream& out, const render::Framebuffer& frame) {
+        const uint32_t width = frame.get_width();
+        const uint32_t height = frame.get_height();
+        out << "P6\n" << width << ' ' << height << "\n255\n";
+
+        std::vector<std::uint8_t> row(static_cast<std::size_t>(width) * 3);
+        for (uint32_t y = 0; y < height; ++y) {
+            const auto* src = reinterpret_cast<const std::uint8_t*>(frame.get_row(y));
+            for (uint32_t x = 0; x < width; ++x) {
+                row[x * 3] = src[x * 4];
+                row[x * 3 + 1] = src[x * 4 + 1];
+                row[x * 3 + 2] = src[x * 4 + 2];
+            }
+            out.write(reinterpret_cast<const char*>(row.data()), static_cast<std::streamsize>(row.size()));
+        }
+    }
+
+    void write_png(std::ostream& out, const render::Framebuffer& frame) {
+        const uint32_t width = frame.get_width();
+        const uint32_t height = frame.get_height();
+        const std::size_t row_bytes = static_cast<std::size_t>(width) * 4;
+
+        static constexpr std::uint8_t SIGNATURE[8] = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n'};
+        out.write(reinterpret_cast<const char*>(SIGNATURE), sizeof(SIGNATURE));
+
+        std::vector<std::uint8_t> ihdr;
+        put_u32_be(ihdr, width);
+        put_u32_be(ihdr, height);
+        ihdr.insert(ihdr.end(), {8, 6, 0, 0, 0}); // 8 бит, RGBA, deflate, фильтры, без interlace
+        write_chunk(out, "IHDR", ihdr);
+
+        // Строки с фильтром 0 (None)
+        std::vector<std::uint8_t> scanlines((row_bytes + 1) * height);
+        for (uint32_t y = 0; y < height; ++y) {
+            std::uint8_t* dst = scanlines.data() + (row_bytes + 1) * y;
+            dst[0] = 0;
+            const auto* src = reinterpret_cast<const std::uint8_t*>(frame.get_row(y));
+            std::copy(src, src + row_bytes, dst + 1);
+        }
+
+        // zlib-поток из stored-блоков по 65535 байт
+        constexpr std::size_t MAX_BLOCK = 65535;
+        const std::size_t blocks = std::max<std::size_t>(1, (scanlines.size() + MAX_BLOCK - 1) / MAX_BLOCK);
+        std::vector<std::uint8_t> idat;
+        idat.reserve(2 + scanlines.size() + blocks * 5 + 4);
+        idat.push_back(0x78);
+        idat.push_back(0x01);
+        for (std::size_t b = 0; b < blocks; ++b) {
+            const std::size_t begin = b * MAX_BLOCK;
+            const std::size_t length = std::min(MAX_BLOCK, scanlines.size() - begin);
+            idat.push_back(b + 1 == blocks ? 1 : 0);
+            idat.push_back(static_cast<std::uint8_t>(length));
+            idat.push_back(static_cast<std::uint8_t>(length >> 8));
+            idat.push_back(static_cast<std::uint8_t>(~length));
+            idat.push_back(static_cast<std::uint8_t>(~length >> 8));
+            idat.insert(idat.end(), scanlines.begin() + static_cast<std::ptrdiff_t>(begin),
+                        scanlines.begin() + static_cast<std::ptrdiff_t>(begin + length));
+        }
+        put_u32_be(idat, adler32(scanlines.data(), scanlines.size()));
+        write_chunk(out, "IDAT", idat);
+
+        write_chunk(out, "IEND", {});
+    }
+
+    void write_raw(std::ostream& out, const render::Framebuffer& frame) {
+        const std::size_t row_bytes = static_cast<std::size_t>(frame.get_width()) * 4;
+        if (frame.get_stride() == frame.get_width()) {
+            out.write(reinterpret_cast<const char*>(frame.get_data()),
+                      static_cast<std::streamsize>(row_bytes * frame.get_height()));
+            return;
+        }
+        for (uint32_t y = 0; y < frame.get_height(); ++y) {
+            out.write(reinterpret_cast<const char*>(frame.get_row(y)), static_cast<std::streamsize>(row_bytes));
+        }
+    }
+
+    void write_image(std::ostream& out, const render::Framebuffer& frame, ImageFormat format) {
+        switch (format) {
+            case ImageFormat::ppm:
+                write_ppm(out, frame);
+                break;
+            case ImageFormat::png:
+                write_png(out, frame);
+                break;
+            case ImageFormat::raw:
+                write_raw(out, frame);
+                break;
+        }
+    }
+
+    void write_image(const std::string& path, const render::Framebuffer& frame) {
+        std::ofstream out(path, std::ios::binary | std::ios::trunc);
+        write_image(out, frame, format_for_path(path));
+        if (!out) {
+            throw std::runtime_error("Cannot write image: " + path);
+        }
+    }
+}
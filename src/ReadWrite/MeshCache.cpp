@@ -0,0 +1,271 @@
+//
+// Created by lunarimoonlin on 12/14/25.
+//
+
+#include "ReadWrite/MeshCache.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+#include <type_traits>
+
+#include "ReadWrite/MeshOptimizer.h"
+
+namespace io {
+    namespace {
+        constexpr char MAGIC[4] = {'K', 'G', 'G', 'M'};
+        constexpr std::size_t SECTION_ALIGN = 16;
+
+        // Секции позиций и нормалей читаются прямо как массивы Vector3f
+        static_assert(sizeof(gmath::Vector3f) == 3 * sizeof(float));
+        static_assert(sizeof(gmath::Vector2f) == 2 * sizeof(float));
+        static_assert(std::is_standard_layout_v<gmath::Vector3f>);
+        static_assert(std::is_standard_layout_v<gmath::Vector2f>);
+        static_assert(std::is_trivially_copyable_v<MeshCacheHeader>);
+
+        constexpr std::size_t align_up(std::size_t value) {
+            return (value + SECTION_ALIGN - 1) & ~(SECTION_ALIGN - 1);
+        }
+
+        struct SourceStamp {
+            std::uint64_t size;
+            std::int64_t mtime;
+        };
+
+        std::optional<SourceStamp> stamp_of(const std::string& path) {
+            std::error_code error;
+            const auto size = std::filesystem::file_size(path, error);
+            if (error) {
+                return std::nullopt;
+            }
+            const auto time = std::filesystem::last_write_time(path, error);
+            if (error) {
+                return std::nullopt;
+            }
+            return SourceStamp{size, static_cast<std::int64_t>(time.time_since_epoch().count())};
+        }
+
+        // Секция [offset, offset + count * element) целиком внутри файла и выровнена
+        bool section_fits(std::uint64_t offset, std::uint64_t count, std::size_t element, std::size_t size) {
+            return offset % SECTION_ALIGN == 0 &&
+                   offset <= size &&
+                   count <= (size - offset) / element;
+        }
+
+        void validate(const char* data, std::size_t size, const std::string& path) {
+            if (size < sizeof(MeshCacheHeader)) {
+                throw std::runtime_error("Mesh cache is truncated: " + path);
+            }
+            const auto& header = *reinterpret_cast<const MeshCacheHeader*>(data);
+            if (std::memcmp(header.magic, MAGIC, sizeof(MAGIC)) != 0) {
+                throw std::runtime_error("Not a mesh cache: " + path);
+            }
+            if (header.version != MeshCache::VERSION) {
+                throw std::runtime_error("Unsupported mesh cache version: " + path);
+            }
+            if ((header.texcoord_count != 0 && header.texcoord_count != header.vertex_count) ||
+                !section_fits(header.positions_offset, header.vertex_count, sizeof(gmath::Vector3f), size) ||
+                !section_fits(header.normals_offset, header.vertex_count, sizeof(gmath::Vector3f), size) ||
+                !section_fits(header.texcoords_offset, header.texcoord_count, sizeof(gmath::Vector2f), size) ||
+                !section_fits(header.indices_offset, header.index_count, sizeof(std::uint32_t), size) ||
+                !section_fits(header.faces_offset, std::uint64_t(header.face_count) + 1, sizeof(std::uint32_t), size)) {
+                throw std::runtime_error("Mesh cache is corrupted: " + path);
+            }
+            const auto* faces = reinterpret_cast<const std::uint32_t*>(data + header.faces_offset);
+            if (faces[0] != 0 || faces[header.face_count] != header.index_count) {
+                throw std::runtime_error("Mesh cache is corrupted: " + path);
+            }
+
+            // Один линейный проход: дальше Mesh / Normal / Render читают без проверок
+            for (std::uint32_t face = 0; face < header.face_count; ++face) {
+                if (faces[face] > faces[face + 1]) {
+                    throw std::runtime_error("Mesh cache is corrupted: " + path);
+                }
+            }
+            const auto* indices = reinterpret_cast<const std::uint32_t*>(data + header.indices_offset);
+            for (std::uint32_t i = 0; i < header.index_count; ++i) {
+                if (indices[i] >= header.vertex_count) {
+                    throw std::runtime_error("Mesh cache is corrupted: " + path);
+                }
+            }
+        }
+
+        // Своё имя на запись: два процесса, собирающие один кэш, не пишут в общий файл
+        std::string temp_path_for(const std::string& cache_path) {
+            std::random_device random;
+            const auto time = std::chrono::steady_clock::now().time_since_epoch().count();
+            std::ostringstream name;
+            name << cache_path << ".tmp." << std::hex << random() << random() << static_cast<std::uint64_t>(time);
+            return name.str();
+        }
+    }
+
+    std::string MeshCache::cache_path_for(const std::string& obj_path) {
+        return obj_path + ".kggmesh";
+    }
+
+    MeshCache MeshCache::open(const std::string& cache_path) {
+        MeshCache cache;
+        cache.m_file.emplace(cache_path);
+        validate(cache.data(), cache.size(), cache_path);
+        return cache;
+    }
+
+    MeshCache MeshCache::load(const std::string& obj_path) {
+        const std::optional<SourceStamp> stamp = stamp_of(obj_path);
+        if (!stamp) {
+            throw std::runtime_error("Cannot open file: " + obj_path);
+        }
+
+        const std::string cache_path = cache_path_for(obj_path);
+        if (std::filesystem::exists(cache_path)) {
+            try {
+                MeshCache cache = open(cache_path);
+                if (cache.header().source_size == stamp->size &&
+                    cache.header().source_mtime == stamp->mtime) {
+                    return cache;
+                }
+            } catch (const std::runtime_error&) {
+                // Повреждённый или старый кэш просто пересобирается
+            }
+        }
+
+        MeshCache cache = build(Reader::read_obj(obj_path));
+        auto& header = *reinterpret_cast<MeshCacheHeader*>(cache.m_image.data());
+        header.source_size = stamp->size;
+        header.source_mtime = stamp->mtime;
+
+        try {
+            cache.save(cache_path);
+            return open(cache_path);
+        } catch (const std::runtime_error&) {
+            // Каталог только для чтения и т.п. — работаем с образом в памяти
+            return cache;
+        }
+    }
+
+    MeshCache MeshCache::build(ObjData obj) {
+        if (obj.positions.size() > std::numeric_limits<std::uint32_t>::max() ||
+            obj.position_indices.size() > std::numeric_limits<std::uint32_t>::max()) {
+            throw std::runtime_error("Mesh is too large for the cache format");
+        }
+
+        optimizer::optimize(obj);
+        const IndexedMesh mesh = obj.indexed();
+
+        MeshCacheHeader header{};
+        std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+        header.version = VERSION;
+        header.vertex_count = static_cast<std::uint32_t>(mesh.positions.size());
+        header.index_count = static_cast<std::uint32_t>(mesh.indices.size());
+        header.face_count = static_cast<std::uint32_t>(obj.face_count());
+        header.texcoord_count = static_cast<std::uint32_t>(mesh.texcoords.size());
+
+        for (int axis = 0; axis < 3; ++axis) {
+            header.bounds_min[axis] = mesh.positions.empty() ? 0.0f : std::numeric_limits<float>::max();
+            header.bounds_max[axis] = mesh.positions.empty() ? 0.0f : std::numeric_limits<float>::lowest();
+        }
+        for (const gmath::Vector3f& p : mesh.positions) {
+            const float xyz[3] = {p.x, p.y, p.z};
+            for (int axis = 0; axis < 3; ++axis) {
+                header.bounds_min[axis] = std::min(header.bounds_min[axis], xyz[axis]);
+                header.bounds_max[axis] = std::max(header.bounds_max[axis], xyz[axis]);
+            }
+        }
+
+        const std::size_t vector_bytes = mesh.positions.size() * sizeof(gmath::Vector3f);
+        const std::size_t texcoord_bytes = mesh.texcoords.size() * sizeof(gmath::Vector2f);
+        const std::size_t index_bytes = mesh.indices.size() * sizeof(std::uint32_t);
+        header.positions_offset = align_up(sizeof(MeshCacheHeader));
+        header.normals_offset = align_up(header.positions_offset + vector_bytes);
+        header.texcoords_offset = align_up(header.normals_offset + vector_bytes);
+        header.indices_offset = align_up(header.texcoords_offset + texcoord_bytes);
+        header.faces_offset = align_up(header.indices_offset + index_bytes);
+        const std::size_t total = header.faces_offset + mesh.face_offsets.size() * sizeof(std::uint32_t);
+
+        MeshCache cache;
+        cache.m_image.assign((total + sizeof(std::uint64_t) - 1) / sizeof(std::uint64_t), 0);
+        cache.m_imageSize = total;
+
+        char* image = reinterpret_cast<char*>(cache.m_image.data());
+        std::memcpy(image, &header, sizeof(header));
+        std::memcpy(image + header.positions_offset, mesh.positions.data(), vector_bytes);
+        std::memcpy(image + header.normals_offset, mesh.normals.data(), vector_bytes);
+        if (texcoord_bytes != 0) {
+            std::memcpy(image + header.texcoords_offset, mesh.texcoords.data(), texcoord_bytes);
+        }
+        std::memcpy(image + header.indices_offset, mesh.indices.data(), index_bytes);
+        std::memcpy(image + header.faces_offset, mesh.face_offsets.data(),
+                    mesh.face_offsets.size() * sizeof(std::uint32_t));
+        return cache;
+    }
+
+    void MeshCache::save(const std::string& cache_path) const {
+        const std::string temp_path = temp_path_for(cache_path);
+        {
+            std::ofstream out(temp_path, std::ios::binary | std::ios::trunc);
+            out.write(data(), static_cast<std::streamsize>(size()));
+            out.close();
+            if (!out) {
+                std::error_code error;
+                std::filesystem::remove(temp_path, error);
+                throw std::runtime_error("Cannot write mesh cache: " + cache_path);
+            }
+        }
+
+        std::error_code error;
+        std::filesystem::rename(temp_path, cache_path, error);
+        if (error) {
+            std::filesystem::remove(temp_path, error);
+            throw std::runtime_error("Cannot write mesh cache: " + cache_path);
+        }
+    }
+
+    const char* MeshCache::data() const {
+        return m_file ? m_file->data() : reinterpret_cast<const char*>(m_image.data());
+    }
+
+    std::size_t MeshCache::size() const {
+        return m_file ? m_file->size() : m_imageSize;
+    }
+
+    const MeshCacheHeader& MeshCache::header() const {
+        return *reinterpret_cast<const MeshCacheHeader*>(data());
+    }
+
+    std::span<const gmath::Vector3f> MeshCache::positions() const {
+        return {reinterpret_cast<const gmath::Vector3f*>(data() + header().positions_offset), vertex_count()};
+    }
+
+    std::span<const gmath::Vector3f> MeshCache::normals() const {
+        return {reinterpret_cast<const gmath::Vector3f*>(data() + header().normals_offset), vertex_count()};
+    }
+
+    std::span<const gmath::Vector2f> MeshCache::texcoords() const {
+        return {reinterpret_cast<const gmath::Vector2f*>(data() + header().texcoords_offset), header().texcoord_count};
+    }
+
+    std::span<const std::uint32_t> MeshCache::indices() const {
+        return {reinterpret_cast<const std::uint32_t*>(data() + header().indices_offset), header().index_count};
+    }
+
+    std::span<const std::uint32_t> MeshCache::face_offsets() const {
+        return {reinterpret_cast<const std::uint32_t*>(data() + header().faces_offset), face_count() + 1};
+    }
+
+    gmath::Vector3f MeshCache::bounds_min() const {
+        const MeshCacheHeader& h = header();
+        return {h.bounds_min[0], h.bounds_min[1], h.bounds_min[2]};
+    }
+
+    gmath::Vector3f MeshCache::bounds_max() const {
+        const MeshCacheHeader& h = header();
+        return {h.bounds_max[0], h.bounds_max[1], h.bounds_max[2]};
+    }
+}
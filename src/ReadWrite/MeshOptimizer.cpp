@@ -0,0 +1,193 @@
+//
+// Created by lunarimoonlin on 12/14/25.
+//
+
+#include "ReadWrite/MeshOptimizer.h"
+
+#include <algorithm>
+#include <limits>
+
+#include "ReadWrite/Reader.h"
+
+namespace io::optimizer {
+    namespace {
+        constexpr std::uint32_t NONE = std::numeric_limits<std::uint32_t>::max();
+
+        template<typename T>
+        void permute_faces(
+            std::vector<T>& values,
+            const std::vector<std::uint32_t>& face_offsets,
+            const std::vector<std::uint32_t>& order
+        ) {
+            std::vector<T> result;
+            result.reserve(values.size());
+            for (const std::uint32_t face : order) {
+                result.insert(result.end(), values.begin() + face_offsets[face], values.begin() + face_offsets[face + 1]);
+            }
+            values = std::move(result);
+        }
+    }
+
+    std::vector<std::uint32_t> tipsify(
+        std::span<const std::uint32_t> indices,
+        std::span<const std::uint32_t> face_offsets,
+        std::size_t vertex_count,
+        std::size_t cache_size
+    ) {
+        const std::size_t face_count = face_offsets.empty() ? 0 : face_offsets.size() - 1;
+        std::vector<std::uint32_t> order;
+        order.reserve(face_count);
+        if (face_count == 0 || vertex_count == 0) {
+            return order;
+        }
+
+        // Смежность вершина -> грани (CSR); live[v] — сколько граней с v ещё не выдано
+        std::vector<std::uint32_t> adjacency_offsets(vertex_count + 1, 0);
+        for (const std::uint32_t v : indices) {
+            ++adjacency_offsets[v + 1];
+        }
+        for (std::size_t v = 0; v < vertex_count; ++v) {
+            adjacency_offsets[v + 1] += adjacency_offsets[v];
+        }
+        std::vector<std::uint32_t> adjacency(indices.size());
+        std::vector<std::uint32_t> live(vertex_count);
+        {
+            std::vector<std::uint32_t> cursor(adjacency_offsets.begin(), adjacency_offsets.end() - 1);
+            for (std::size_t face = 0; face < face_count; ++face) {
+                for (std::uint32_t k = face_offsets[face]; k < face_offsets[face + 1]; ++k) {
+                    adjacency[cursor[indices[k]]++] = static_cast<std::uint32_t>(face);
+                    ++live[indices[k]];
+                }
+            }
+        }
+
+        std::vector<std::uint64_t> cache_time(vertex_count, 0);
+        std::vector<bool> emitted(face_count, false);
+        std::vector<std::uint32_t> dead_end;     // стек вершин недавно выданных граней
+        std::vector<std::uint32_t> candidates;
+        std::uint64_t time = cache_size + 1;
+        std::size_t cursor = 0;                  // следующая вершина по порядку ввода
+
+        std::uint32_t fan = indices[face_offsets[0]];
+        while (fan != NONE) {
+            // 1. Выдать все ещё не выданные грани вокруг fan
+            candidates.clear();
+            for (std::uint32_t a = adjacency_offsets[fan]; a < adjacency_offsets[fan + 1]; ++a) {
+                const std::uint32_t face = adjacency[a];
+                if (emitted[face]) {
+                    continue;
+                }
+                emitted[face] = true;
+                order.push_back(face);
+
+                for (std::uint32_t k = face_offsets[face]; k < face_offsets[face + 1]; ++k) {
+                    const std::uint32_t v = indices[k];
+                    dead_end.push_back(v);
+                    candidates.push_back(v);
+                    --live[v];
+                    if (time - cache_time[v] > cache_size) {
+                        cache_time[v] = time++;
+                    }
+                }
+            }
+
+            // 2. Следующий центр веера: вершина, которая после своего веера ещё будет в кэше
+            fan = NONE;
+            std::int64_t best = -1;
+            for (const std::uint32_t v : candidates) {
+                if (live[v] == 0) {
+                    continue;
+                }
+                std::int64_t priority = 0;
+                if (time - cache_time[v] + 2 * std::uint64_t(live[v]) <= cache_size) {
+                    priority = static_cast<std::int64_t>(time - cache_time[v]);
+                }
+                if (priority > best) {
+                    best = priority;
+                    fan = v;
+                }
+            }
+
+            // 3. Тупик: сначала недавние вершины, затем по порядку ввода
+            while (fan == NONE && !dead_end.empty()) {
+                const std::uint32_t v = dead_end.back();
+                dead_end.pop_back();
+                if (live[v] > 0) {
+                    fan = v;
+                }
+            }
+            while (fan == NONE && cursor < vertex_count) {
+                if (live[cursor] > 0) {
+                    fan = static_cast<std::uint32_t>(cursor);
+                }
+                ++cursor;
+            }
+        }
+
+        return order;
+    }
+
+    std::vector<std::uint32_t> first_use_order(std::span<const std::uint32_t> indices, std::size_t vertex_count) {
+        std::vector<std::uint32_t> remap(vertex_count, NONE);
+        std::uint32_t next = 0;
+        for (const std::uint32_t v : indices) {
+            if (remap[v] == NONE) {
+                remap[v] = next++;
+            }
+        }
+        for (std::uint32_t& v : remap) {
+            if (v == NONE) {
+                v = next++;
+            }
+        }
+        return remap;
+    }
+
+    float average_cache_miss_ratio(std::span<const std::uint32_t> triangles, std::size_t cache_size) {
+        if (triangles.size() < 3) {
+            return 0.0f;
+        }
+
+        // FIFO на кольцевом буфере + отметка «в кэше» по времени входа
+        std::uint32_t max_index = 0;
+        for (const std::uint32_t v : triangles) {
+            max_index = std::max(max_index, v);
+        }
+        std::vector<std::uint64_t> entered(std::size_t(max_index) + 1, 0);
+        std::uint64_t misses = 0;
+        for (const std::uint32_t v : triangles) {
+            if (entered[v] == 0 || misses + 1 - entered[v] > cache_size) {
+                ++misses;
+                entered[v] = misses;
+            }
+        }
+        return static_cast<float>(misses) / static_cast<float>(triangles.size() / 3);
+    }
+
+    void optimize(ObjData& obj, std::size_t cache_size) {
+        // 1. Порядок граней
+        const std::vector<std::uint32_t> order = tipsify(obj.position_indices, obj.face_offsets, obj.positions.size(), cache_size);
+
+        permute_faces(obj.position_indices, obj.face_offsets, order);
+        permute_faces(obj.texcoord_indices, obj.face_offsets, order);
+        permute_faces(obj.normal_indices, obj.face_offsets, order);
+
+        std::vector<std::uint32_t> offsets{0};
+        offsets.reserve(obj.face_offsets.size());
+        for (const std::uint32_t face : order) {
+            offsets.push_back(offsets.back() + obj.face_offsets[face + 1] - obj.face_offsets[face]);
+        }
+        obj.face_offsets = std::move(offsets);
+
+        // 2. Порядок позиций
+        const std::vector<std::uint32_t> remap = first_use_order(obj.position_indices, obj.positions.size());
+        std::vector<gmath::Vector3f> positions(obj.positions.size());
+        for (std::size_t v = 0; v < remap.size(); ++v) {
+            positions[remap[v]] = obj.positions[v];
+        }
+        obj.positions = std::move(positions);
+        for (std::uint32_t& v : obj.position_indices) {
+            v = remap[v];
+        }
+    }
+}
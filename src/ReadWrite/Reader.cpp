@@ -1,3 +1,460 @@
 //
 // Created by lunarimoonlin on 12/14/25.
 //
+
+#include "ReadWrite/Reader.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <thread>
+#include <unordered_map>
+
+#include "Light/Normal.hpp"
+#include "ReadWrite/MappedFile.h"
+
+namespace io {
+    namespace {
+        // Меньше этого кусок не делится: накладные расходы потока дороже разбора
+        constexpr std::size_t MIN_CHUNK_BYTES = 1 << 20;
+
+        // Ключ вершины OBJ: индексы позиции, текстурной координаты и нормали
+        struct CornerKey {
+            std::uint32_t v, vt, vn;
+
+            bool operator==(const CornerKey&) const = default;
+        };
+
+        struct CornerKeyHash {
+            std::size_t operator()(const CornerKey& key) const {
+                std::uint64_t h = key.v;
+                h = h * 0x9E3779B97F4A7C15ull ^ key.vt;
+                h = h * 0x9E3779B97F4A7C15ull ^ key.vn;
+                return static_cast<std::size_t>(h ^ (h >> 29));
+            }
+        };
+
+        constexpr double POW10[] = {
+            1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+            1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+        };
+
+        inline bool is_space(char c) {
+            return c == ' ' || c == '\t' || c == '\r';
+        }
+
+        inline bool is_digit(char c) {
+            return static_cast<unsigned char>(c - '0') < 10;
+        }
+
+        inline const char* skip_spaces(const char* p, const char* end) {
+            while (p < end && is_space(*p)) {
+                ++p;
+            }
+            return p;
+        }
+
+        /**
+         * Разбор десятичного числа с плавающей точкой ([-+]digits[.digits][e[-+]digits]).
+         * Мантисса копится в uint64 (до 19 значащих цифр), затем одно умножение
+         * или деление на степень десяти — для данных мешей точности double хватает
+         */
+        const char* parse_float(const char* p, const char* end, float& out) {
+            bool negative = false;
+            if (p < end && (*p == '-' || *p == '+')) {
+                negative = *p == '-';
+                ++p;
+            }
+
+            std::uint64_t mantissa = 0;
+            int exponent = 0;
+            int digits = 0;
+            const char* start = p;
+
+            for (; p < end && is_digit(*p); ++p) {
+                if (digits < 19) {
+                    mantissa = mantissa * 10 + static_cast<std::uint64_t>(*p - '0');
+                    if (mantissa) ++digits;
+                } else {
+                    ++exponent;
+                }
+            }
+            if (p < end && *p == '.') {
+                for (++p; p < end && is_digit(*p); ++p) {
+                    if (digits < 19) {
+                        mantissa = mantissa * 10 + static_cast<std::uint64_t>(*p - '0');
+                        if (mantissa) ++digits;
+                        --exponent;
+                    }
+                }
+            }
+            if (p == start) {
+                return nullptr;
+            }
+            if (p < end && (*p == 'e' || *p == 'E')) {
+                const char* q = p + 1;
+                bool exp_negative = false;
+                if (q < end && (*q == '-' || *q == '+')) {
+                    exp_negative = *q == '-';
+                    ++q;
+                }
+                if (q < end && is_digit(*q)) {
+                    int value = 0;
+                    for (; q < end && is_digit(*q); ++q) {
+                        value = std::min(value * 10 + (*q - '0'), 10000);
+                    }
+                    exponent += exp_negative ? -value : value;
+                    p = q;
+                }
+            }
+
+            double value = static_cast<double>(mantissa);
+            if (exponent > 0) {
+                value *= exponent <= 22 ? POW10[exponent] : std::pow(10.0, exponent);
+            } else if (exponent < 0) {
+                value /= -exponent <= 22 ? POW10[-exponent] : std::pow(10.0, -exponent);
+            }
+            out = static_cast<float>(negative ? -value : value);
+            return p;
+        }
+
+        // Индексы OBJ по модулю не больше UINT32_MAX; более длинные числа — ошибка разбора
+        constexpr std::int64_t MAX_INDEX = std::numeric_limits<std::uint32_t>::max();
+
+        const char* parse_int(const char* p, const char* end, std::int64_t& out) {
+            bool negative = false;
+            if (p < end && (*p == '-' || *p == '+')) {
+                negative = *p == '-';
+                ++p;
+            }
+            if (p >= end || !is_digit(*p)) {
+                return nullptr;
+            }
+            std::int64_t value = 0;
+            for (; p < end && is_digit(*p); ++p) {
+                value = value * 10 + (*p - '0');
+                if (value > MAX_INDEX) {
+                    return nullptr;
+                }
+            }
+            out = negative ? -value : value;
+            return p;
+        }
+
+        /**
+         * Результат разбора одного куска. Положительные индексы уже глобальные,
+         * отрицательные отсчитаны от числа вершин куска — при склейке к ним
+         * прибавляется число вершин предыдущих кусков (позиции в *_fixups)
+         */
+        struct Chunk {
+            ObjData data;
+            std::vector<std::uint32_t> position_fixups;
+            std::vector<std::uint32_t> texcoord_fixups;
+            std::vector<std::uint32_t> normal_fixups;
+            std::size_t line = 0;
+            std::string error;
+        };
+
+        // Индекс OBJ (1-based или отрицательный) -> значение для *_indices
+        inline std::uint32_t resolve(
+            std::int64_t index,
+            std::size_t local_count,
+            std::vector<std::uint32_t>& fixups,
+            std::size_t slot
+        ) {
+            if (index > 0) {
+                return static_cast<std::uint32_t>(index - 1);
+            }
+            fixups.push_back(static_cast<std::uint32_t>(slot));
+            // Может уйти в «минус» (ссылка в предыдущий кусок) — знак проверяется при склейке
+            return static_cast<std::uint32_t>(static_cast<std::int64_t>(local_count) + index);
+        }
+
+        void parse_chunk(const char* p, const char* end, Chunk& chunk) {
+            ObjData& data = chunk.data;
+
+            while (p < end) {
+                const char* line_end = static_cast<const char*>(std::memchr(p, '\n', end - p));
+                if (!line_end) {
+                    line_end = end;
+                }
+                ++chunk.line;
+
+                const char* q = skip_spaces(p, line_end);
+                if (q + 1 < line_end && q[0] == 'v' && is_space(q[1])) {
+                    gmath::Vector3f v;
+                    q = parse_float(skip_spaces(q + 2, line_end), line_end, v.x);
+                    if (q) q = parse_float(skip_spaces(q, line_end), line_end, v.y);
+                    if (q) q = parse_float(skip_spaces(q, line_end), line_end, v.z);
+                    if (!q) {
+                        chunk.error = "bad vertex";
+                        return;
+                    }
+                    data.positions.push_back(v);
+                } else if (q + 2 < line_end && q[0] == 'v' && q[1] == 'n' && is_space(q[2])) {
+                    gmath::Vector3f n;
+                    q = parse_float(skip_spaces(q + 3, line_end), line_end, n.x);
+                    if (q) q = parse_float(skip_spaces(q, line_end), line_end, n.y);
+                    if (q) q = parse_float(skip_spaces(q, line_end), line_end, n.z);
+                    if (!q) {
+                        chunk.error = "bad normal";
+                        return;
+                    }
+                    data.normals.push_back(n);
+                } else if (q + 2 < line_end && q[0] == 'v' && q[1] == 't' && is_space(q[2])) {
+                    gmath::Vector2f t;
+                    q = parse_float(skip_spaces(q + 3, line_end), line_end, t.x);
+                    // Вторая координата необязательна
+                    if (q) {
+                        const char* r = skip_spaces(q, line_end);
+                        if (r < line_end && !parse_float(r, line_end, t.y)) {
+                            t.y = 0.0f;
+                        }
+                    }
+                    if (!q) {
+                        chunk.error = "bad texcoord";
+                        return;
+                    }
+                    data.texcoords.push_back(t);
+                } else if (q + 1 < line_end && q[0] == 'f' && is_space(q[1])) {
+                    q = skip_spaces(q + 2, line_end);
+                    std::size_t corners = 0;
+                    while (q < line_end) {
+                        const std::size_t slot = data.position_indices.size();
+                        std::int64_t v = 0;
+                        q = parse_int(q, line_end, v);
+                        if (!q || v == 0) {
+                            chunk.error = "bad face";
+                            return;
+                        }
+                        std::uint32_t vt = ObjData::NO_INDEX;
+                        std::uint32_t vn = ObjData::NO_INDEX;
+                        if (q < line_end && *q == '/') {
+                            ++q;
+                            std::int64_t index = 0;
+                            if (q < line_end && *q != '/') {
+                                q = parse_int(q, line_end, index);
+                                if (!q || index == 0) {
+                                    chunk.error = "bad face";
+                                    return;
+                                }
+                                vt = resolve(index, data.texcoords.size(), chunk.texcoord_fixups, slot);
+                            }
+                            if (q < line_end && *q == '/') {
+                                ++q;
+                                q = parse_int(q, line_end, index);
+                                if (!q || index == 0) {
+                                    chunk.error = "bad face";
+                                    return;
+                                }
+                                vn = resolve(index, data.normals.size(), chunk.normal_fixups, slot);
+                            }
+                        }
+                        data.position_indices.push_back(
+                            resolve(v, data.positions.size(), chunk.position_fixups, slot));
+                        data.texcoord_indices.push_back(vt);
+                        data.normal_indices.push_back(vn);
+                        ++corners;
+                        q = skip_spaces(q, line_end);
+                    }
+                    if (corners < 3) {
+                        chunk.error = "face with fewer than 3 vertices";
+                        return;
+                    }
+                    data.face_offsets.push_back(static_cast<std::uint32_t>(data.position_indices.size()));
+                }
+                // Остальное (#, o, g, s, usemtl, mtllib) загрузчику не нужно
+
+                p = line_end + 1;
+            }
+        }
+
+        template<typename T>
+        void append(std::vector<T>& to, const std::vector<T>& from) {
+            to.insert(to.end(), from.begin(), from.end());
+        }
+
+        // Относительные индексы куска -> глобальные: + число элементов предыдущих кусков
+        void apply_fixups(
+            std::vector<std::uint32_t>& indices,
+            const std::vector<std::uint32_t>& fixups,
+            std::uint32_t base,
+            const char* what
+        ) {
+            for (const std::uint32_t slot : fixups) {
+                const std::int64_t index = static_cast<std::int32_t>(indices[slot]) + std::int64_t(base);
+                if (index < 0) {
+                    throw std::runtime_error(std::string("OBJ: ") + what + " index out of range");
+                }
+                indices[slot] = static_cast<std::uint32_t>(index);
+            }
+        }
+
+        void check_indices(const std::vector<std::uint32_t>& indices, std::size_t count, const char* what) {
+            for (const std::uint32_t index : indices) {
+                if (index != ObjData::NO_INDEX && index >= count) {
+                    throw std::runtime_error(std::string("OBJ: ") + what + " index out of range");
+                }
+            }
+        }
+    }
+
+    std::vector<std::vector<int>> ObjData::polygons() const {
+        std::vector<std::vector<int>> result(face_count());
+        for (std::size_t face = 0; face < result.size(); ++face) {
+            result[face].assign(
+                position_indices.begin() + face_offsets[face],
+                position_indices.begin() + face_offsets[face + 1]
+            );
+        }
+        return result;
+    }
+
+    IndexedMesh ObjData::indexed() const {
+        IndexedMesh mesh;
+        mesh.face_offsets = face_offsets;
+
+        // Наличие атрибута решается по всем углам, а не по первому
+        const auto is_set = [](std::uint32_t index) { return index != NO_INDEX; };
+        const bool has_texcoords = !texcoords.empty() && std::ranges::any_of(texcoord_indices, is_set);
+        // Нормаль у части углов не восполнить значением по умолчанию — тогда считаем все
+        const bool has_normals = !normals.empty() && !normal_indices.empty() && std::ranges::all_of(normal_indices, is_set);
+
+        if (!has_texcoords && !has_normals) {
+            // Только позиции: вершины совпадают с вершинами OBJ
+            mesh.positions = positions;
+            mesh.indices = position_indices;
+        } else {
+            // Склейка одинаковых троек (v, vt, vn) в одну вершину
+            std::unordered_map<CornerKey, std::uint32_t, CornerKeyHash> vertices;
+            vertices.reserve(positions.size());
+            mesh.positions.reserve(positions.size());
+            mesh.indices.resize(position_indices.size());
+
+            for (std::size_t corner = 0; corner < position_indices.size(); ++corner) {
+                const CornerKey key{
+                    position_indices[corner],
+                    has_texcoords ? texcoord_indices[corner] : NO_INDEX,
+                    has_normals ? normal_indices[corner] : NO_INDEX
+                };
+                const auto [it, inserted] = vertices.try_emplace(key, static_cast<std::uint32_t>(mesh.positions.size()));
+                if (inserted) {
+                    mesh.positions.push_back(positions[key.v]);
+                    if (has_normals) {
+                        mesh.normals.push_back(normals[key.vn]);
+                    }
+                    if (has_texcoords) {
+                        mesh.texcoords.push_back(key.vt != NO_INDEX ? texcoords[key.vt] : gmath::Vector2f(0.0f, 0.0f));
+                    }
+                }
+                mesh.indices[corner] = it->second;
+            }
+        }
+
+        if (!has_normals) {
+            gmath::MeshView<float> view;
+            if (!mesh.positions.empty()) {
+                view.x = &mesh.positions[0].x;
+                view.y = &mesh.positions[0].y;
+                view.z = &mesh.positions[0].z;
+            }
+            view.stride = 3;
+            view.vertex_count = mesh.positions.size();
+            view.indices = mesh.indices.data();
+            view.face_offsets = mesh.face_offsets.data();
+            view.face_count = face_count();
+
+            gmath::Normal<float> normal(view.vertex_count, view.face_count);
+            normal.compute_all(view, gmath::NormalWeighting::angle);
+            mesh.normals = normal.get_vertex_normals();
+        }
+        return mesh;
+    }
+
+    ObjData Reader::read_obj(const std::string& path, std::size_t threads) {
+        const MappedFile file(path);
+        if (threads == 0) {
+            threads = std::max(1u, std::thread::hardware_concurrency());
+        }
+        return parse_obj(file.view(), threads);
+    }
+
+    ObjData Reader::parse_obj(std::string_view text, std::size_t threads) {
+        const char* begin = text.data();
+        const char* end = begin + text.size();
+
+        // 1. Куски примерно равного размера, граница сдвигается на конец строки
+        threads = std::clamp<std::size_t>(text.size() / MIN_CHUNK_BYTES, 1, std::max<std::size_t>(threads, 1));
+        std::vector<const char*> bounds{begin};
+        for (std::size_t i = 1; i < threads; ++i) {
+            const char* p = std::max(bounds.back(), begin + text.size() * i / threads);
+            const char* newline = static_cast<const char*>(std::memchr(p, '\n', end - p));
+            if (!newline) {
+                break;
+            }
+            bounds.push_back(newline + 1);
+        }
+        bounds.push_back(end);
+
+        // 2. Параллельный разбор
+        std::vector<Chunk> chunks(bounds.size() - 1);
+        {
+            std::vector<std::jthread> workers;
+            for (std::size_t i = 1; i < chunks.size(); ++i) {
+                workers.emplace_back([&, i] { parse_chunk(bounds[i], bounds[i + 1], chunks[i]); });
+            }
+            parse_chunk(bounds[0], bounds[1], chunks[0]);
+        }
+
+        std::size_t line_base = 0;
+        for (const Chunk& chunk : chunks) {
+            if (!chunk.error.empty()) {
+                throw std::runtime_error(
+                    "OBJ: " + chunk.error + " at line " + std::to_string(line_base + chunk.line));
+            }
+            line_base += chunk.line;
+        }
+
+        if (chunks.size() == 1) {
+            ObjData& data = chunks[0].data;
+            apply_fixups(data.position_indices, chunks[0].position_fixups, 0, "vertex");
+            apply_fixups(data.texcoord_indices, chunks[0].texcoord_fixups, 0, "texcoord");
+            apply_fixups(data.normal_indices, chunks[0].normal_fixups, 0, "normal");
+            check_indices(data.position_indices, data.positions.size(), "vertex");
+            check_indices(data.texcoord_indices, data.texcoords.size(), "texcoord");
+            check_indices(data.normal_indices, data.normals.size(), "normal");
+            return std::move(data);
+        }
+
+        // 3. Склейка: смещения граней и относительные индексы
+        ObjData result;
+        for (Chunk& chunk : chunks) {
+            ObjData& data = chunk.data;
+            const auto positions_base = static_cast<std::uint32_t>(result.positions.size());
+            const auto texcoords_base = static_cast<std::uint32_t>(result.texcoords.size());
+            const auto normals_base = static_cast<std::uint32_t>(result.normals.size());
+            const auto index_base = static_cast<std::uint32_t>(result.position_indices.size());
+
+            apply_fixups(data.position_indices, chunk.position_fixups, positions_base, "vertex");
+            apply_fixups(data.texcoord_indices, chunk.texcoord_fixups, texcoords_base, "texcoord");
+            apply_fixups(data.normal_indices, chunk.normal_fixups, normals_base, "normal");
+
+            append(result.positions, data.positions);
+            append(result.texcoords, data.texcoords);
+            append(result.normals, data.normals);
+            append(result.position_indices, data.position_indices);
+            append(result.texcoord_indices, data.texcoord_indices);
+            append(result.normal_indices, data.normal_indices);
+            for (std::size_t face = 1; face < data.face_offsets.size(); ++face) {
+                result.face_offsets.push_back(data.face_offsets[face] + index_base);
+            }
+        }
+
+        check_indices(result.position_indices, result.positions.size(), "vertex");
+        check_indices(result.texcoord_indices, result.texcoords.size(), "texcoord");
+        check_indices(result.normal_indices, result.normals.size(), "normal");
+        return result;
+    }
+}
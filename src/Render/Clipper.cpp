@@ -0,0 +1,151 @@
+//
+// Created by shulz on 18.12.2025.
+//
+
+#include "Render/Clipper.h"
+
+#include <cmath>
+
+namespace render {
+    namespace {
+        enum Plane : std::uint32_t {
+            NEAR   = 1u << 0,
+            FAR    = 1u << 1,
+            LEFT   = 1u << 2,
+            RIGHT  = 1u << 3,
+            BOTTOM = 1u << 4,
+            TOP    = 1u << 5,
+        };
+
+        constexpr std::uint32_t ALL_PLANES = NEAR | FAR | LEFT | RIGHT | BOTTOM | TOP;
+
+        // Расстояние со знаком до плоскости (>= 0 — внутри)
+        float distance(const gmath::Vector4<float>& v, Plane plane, float band) {
+            switch (plane) {
+                case NEAR:   return v.z + v.w;
+                case FAR:    return v.w - v.z;
+                case LEFT:   return band * v.w + v.x;
+                case RIGHT:  return band * v.w - v.x;
+                case BOTTOM: return band * v.w + v.y;
+                case TOP:    return band * v.w - v.y;
+            }
+            return 0.0f;
+        }
+    }
+
+    Rect Viewport::rect() const {
+        return {
+            static_cast<int>(std::floor(x)),
+            static_cast<int>(std::floor(y)),
+            static_cast<int>(std::ceil(x + width)),
+            static_cast<int>(std::ceil(y + height))
+        };
+    }
+
+    Clipper::Clipper(const Viewport& viewport, float guard_band)
+        : m_viewport(viewport), m_guardBand(guard_band)
+    {}
+
+    const Viewport& Clipper::get_viewport() const {
+        return m_viewport;
+    }
+
+    float Clipper::get_guard_band() const {
+        return m_guardBand;
+    }
+
+    std::uint32_t Clipper::outcode(const gmath::Vector4<float>& v, float band) const {
+        std::uint32_t code = 0;
+        for (std::uint32_t bit = 1; bit & ALL_PLANES; bit <<= 1) {
+            if (distance(v, static_cast<Plane>(bit), band) < 0.0f) {
+                code |= bit;
+            }
+        }
+        return code;
+    }
+
+    ScreenVertex Clipper::to_screen(const ClipVertex& v) const {
+        const float inv_w = 1.0f / v.position.w;
+        const float ndc_x = v.position.x * inv_w;
+        const float ndc_y = v.position.y * inv_w;
+        const float ndc_z = v.position.z * inv_w;
+
+        return {
+            {
+                m_viewport.x + (ndc_x * 0.5f + 0.5f) * m_viewport.width,
+                m_viewport.y + (0.5f - ndc_y * 0.5f) * m_viewport.height,
+                ndc_z * 0.5f + 0.5f
+            },
+            inv_w,
+            v.barycentric
+        };
+    }
+
+    Clipper::Polygon Clipper::clip_triangle(
+        const gmath::Vector4<float>& a,
+        const gmath::Vector4<float>& b,
+        const gmath::Vector4<float>& c
+    ) const {
+        Polygon result;
+
+        // 1. Целиком за одной плоскостью viewport (или near/far) — не виден
+        const std::uint32_t view_a = outcode(a, 1.0f);
+        const std::uint32_t view_b = outcode(b, 1.0f);
+        const std::uint32_t view_c = outcode(c, 1.0f);
+        if (view_a & view_b & view_c) {
+            return result;
+        }
+
+        std::array<ClipVertex, MAX_VERTICES> input{};
+        input[0] = {a, {1.0f, 0.0f, 0.0f}};
+        input[1] = {b, {0.0f, 1.0f, 0.0f}};
+        input[2] = {c, {0.0f, 0.0f, 1.0f}};
+        int count = 3;
+
+        // 2. Резать нужно только по плоскостям, которые пересекает хоть одна вершина.
+        //    По x, y вместо границ viewport используются границы guard band
+        const std::uint32_t planes =
+            ((view_a | view_b | view_c) & (NEAR | FAR)) |
+            ((outcode(a, m_guardBand) | outcode(b, m_guardBand) | outcode(c, m_guardBand)) & ~(NEAR | FAR));
+
+        std::array<ClipVertex, MAX_VERTICES> output{};
+        for (std::uint32_t bit = 1; (bit & ALL_PLANES) && count >= 3; bit <<= 1) {
+            if (!(planes & bit)) {
+                continue;
+            }
+            const auto plane = static_cast<Plane>(bit);
+
+            // Sutherland–Hodgman для одной плоскости
+            int out_count = 0;
+            for (int i = 0; i < count; ++i) {
+                const ClipVertex& current = input[i];
+                const ClipVertex& next = input[(i + 1) % count];
+                const float d_current = distance(current.position, plane, m_guardBand);
+                const float d_next = distance(next.position, plane, m_guardBand);
+
+                if (d_current >= 0.0f) {
+                    output[out_count++] = current;
+                }
+                if ((d_current >= 0.0f) != (d_next >= 0.0f)) {
+                    const float t = d_current / (d_current - d_next);
+                    output[out_count++] = {
+                        current.position + (next.position - current.position) * t,
+                        current.barycentric + (next.barycentric - current.barycentric) * t
+                    };
+                }
+            }
+            input = output;
+            count = out_count;
+        }
+
+        if (count < 3) {
+            return result;
+        }
+
+        result.count = count;
+        for (int i = 0; i < count; ++i) {
+            result.vertices[i] = to_screen(input[i]);
+        }
+        return result;
+    }
+}
@@ -3,3 +3,145 @@
 //
 
 #include <Render/Mesh.h>
+
+#include <utility>
+
+#include "Light/Normal.hpp"
+#include "ReadWrite/MeshCache.h"
+#include "ReadWrite/MeshOptimizer.h"
+#include "ReadWrite/Reader.h"
+
+void Mesh::assign_vertices(
+    std::span<const gmath::Vector3f> positions,
+    std::span<const gmath::Vector3f> normals,
+    std::span<const gmath::Vector2f> texcoords
+) {
+    // AoS -> SoA: один проход по каждому массиву
+    m_x.resize(positions.size());
+    m_y.resize(positions.size());
+    m_z.resize(positions.size());
+    for (std::size_t i = 0; i < positions.size(); ++i) {
+        m_x[i] = positions[i].x;
+        m_y[i] = positions[i].y;
+        m_z[i] = positions[i].z;
+    }
+    m_nx.resize(normals.size());
+    m_ny.resize(normals.size());
+    m_nz.resize(normals.size());
+    for (std::size_t i = 0; i < normals.size(); ++i) {
+        m_nx[i] = normals[i].x;
+        m_ny[i] = normals[i].y;
+        m_nz[i] = normals[i].z;
+    }
+    m_u.resize(texcoords.size());
+    m_v.resize(texcoords.size());
+    for (std::size_t i = 0; i < texcoords.size(); ++i) {
+        m_u[i] = texcoords[i].x;
+        m_v[i] = texcoords[i].y;
+    }
+}
+
+void Mesh::triangulate(std::span<const std::uint32_t> polygon_indices, std::span<const std::uint32_t> polygon_offsets) {
+    m_indices.clear();
+    m_faceOffsets.assign(1, 0);
+    m_faceOffsets.reserve(polygon_offsets.size());
+
+    // n-угольник даёт n - 2 треугольника
+    m_indices.reserve((polygon_indices.size() - 2 * (polygon_offsets.size() - 1)) * 3);
+
+    for (std::size_t face = 0; face + 1 < polygon_offsets.size(); ++face) {
+        const std::uint32_t begin = polygon_offsets[face];
+        const std::uint32_t end = polygon_offsets[face + 1];
+        // Веер (0, i, i + 1): корректен для выпуклых граней, какими их пишут экспортёры
+        for (std::uint32_t i = begin + 1; i + 1 < end; ++i) {
+            m_indices.push_back(polygon_indices[begin]);
+            m_indices.push_back(polygon_indices[i]);
+            m_indices.push_back(polygon_indices[i + 1]);
+        }
+        m_faceOffsets.push_back(static_cast<std::uint32_t>(m_indices.size() / 3));
+    }
+}
+
+Mesh Mesh::from_obj(const io::ObjData& obj) {
+    const io::IndexedMesh indexed = obj.indexed();
+    Mesh mesh;
+    mesh.assign_vertices(indexed.positions, indexed.normals, indexed.texcoords);
+    mesh.triangulate(indexed.indices, indexed.face_offsets);
+    return mesh;
+}
+
+Mesh Mesh::from_cache(const io::MeshCache& cache) {
+    Mesh mesh;
+    mesh.assign_vertices(cache.positions(), cache.normals(), cache.texcoords());
+    mesh.triangulate(cache.indices(), cache.face_offsets());
+    return mesh;
+}
+
+Mesh Mesh::load(const std::string& obj_path) {
+    return from_cache(io::MeshCache::load(obj_path));
+}
+
+gmath::MeshView<float> Mesh::view() const {
+    gmath::MeshView<float> view;
+    view.x = m_x.data();
+    view.y = m_y.data();
+    view.z = m_z.data();
+    view.stride = 1;
+    view.vertex_count = vertex_count();
+    view.indices = m_indices.data();
+    view.face_count = triangle_count();
+    return view;
+}
+
+void Mesh::compute_normals() {
+    gmath::Normal<float> normal(vertex_count(), triangle_count());
+    const gmath::MeshView<float> mesh = view();
+    normal.compute_all(mesh, gmath::NormalWeighting::area);
+
+    const auto& normals = normal.get_vertex_normals();
+    m_nx.resize(normals.size());
+    m_ny.resize(normals.size());
+    m_nz.resize(normals.size());
+    for (std::size_t i = 0; i < normals.size(); ++i) {
+        m_nx[i] = normals[i].x;
+        m_ny[i] = normals[i].y;
+        m_nz[i] = normals[i].z;
+    }
+}
+
+void Mesh::optimize(std::size_t cache_size) {
+    // Грань — набор индексов её треугольников
+    std::vector<std::uint32_t> offsets(m_faceOffsets.size());
+    for (std::size_t i = 0; i < offsets.size(); ++i) {
+        offsets[i] = m_faceOffsets[i] * 3;
+    }
+    const std::vector<std::uint32_t> order = io::optimizer::tipsify(m_indices, offsets, vertex_count(), cache_size);
+
+    std::vector<std::uint32_t> indices;
+    indices.reserve(m_indices.size());
+    std::vector<std::uint32_t> face_offsets{0};
+    face_offsets.reserve(m_faceOffsets.size());
+    for (const std::uint32_t face : order) {
+        indices.insert(indices.end(), m_indices.begin() + offsets[face], m_indices.begin() + offsets[face + 1]);
+        face_offsets.push_back(static_cast<std::uint32_t>(indices.size() / 3));
+    }
+
+    const std::vector<std::uint32_t> remap = io::optimizer::first_use_order(indices, vertex_count());
+    for (std::uint32_t& v : indices) {
+        v = remap[v];
+    }
+    m_indices = std::move(indices);
+    m_faceOffsets = std::move(face_offsets);
+
+    Stream reordered;
+    for (Stream* stream : {&m_x, &m_y, &m_z, &m_nx, &m_ny, &m_nz, &m_u, &m_v}) {
+        if (stream->empty()) {
+            continue;
+        }
+        reordered.resize(stream->size());
+        for (std::size_t v = 0; v < remap.size(); ++v) {
+            reordered[remap[v]] = (*stream)[v];
+        }
+        stream->swap(reordered);
+    }
+}
@@ -6,51 +6,56 @@
 
 #include <algorithm>
 
+#include "Profile/Profiler.h"
+#include "Render/FragmentLoop.h"
+#include "Render/Interpolator.h"
+#include "Render/RasterizerSimd.h"
+#include "Render/TriangleSetup.h"
+
 namespace render {
-    static float edge(
-        const gmath::Vector2<float>& a,
-        const gmath::Vector2<float>& b,
-        const gmath::Vector2<float>& c
-        ) {
-        return (c.x - a.x) * (b.y - a.y) - (c.y - a.y) * (b.x - a.x);
+    using ColorInterpolator = Interpolator<4>;
+
+    static ColorInterpolator::Values to_values(const Color& color) {
+        return {float(color.r), float(color.g), float(color.b), float(color.a)};
     }
 
-    static Color interpolate_color(
-        float alpha,
-        float beta,
-        float gamma,
-        const Color& a,
-        const Color& b,
-        const Color& c
-    ) {
-        // Lambda-функция, ограничиваем в нужной области чисел и приводим из float к
+    static Color to_color(const ColorInterpolator::Values& values) {
+        // Ограничиваем в нужной области чисел и приводим из float к
         // uint8_t, т.к. Color такой тип и хранит
         auto clamp = [](float v) {
             return static_cast<std::uint8_t>(
                 std::clamp(v, 0.0f, 255.0f)
             );
         };
+        return Color(clamp(values[0]), clamp(values[1]), clamp(values[2]), clamp(values[3]));
+    }
 
-        float r = alpha * a.r + beta * b.r + gamma * c.r;
-
-        float g = alpha * a.g + beta * b.g + gamma * c.g;
-
-        float b_col = alpha * a.b + beta * b.b + gamma * c.b;
-
-        float a_col = alpha * a.a + beta * b.a + gamma * c.a;
+    static Rect full_rect(const Framebuffer& framebuffer) {
+        return {
+            0, 0,
+            static_cast<int>(framebuffer.get_width()),
+            static_cast<int>(framebuffer.get_height())
+        };
+    }
 
-        return Color(
-            clamp(r),
-            clamp(g),
-            clamp(b_col),
-            clamp(a_col)
-        );
+    // Счётчики profile для треугольника, прошедшего или не прошедшего TriangleSetup
+    static void count_triangle(bool rasterized) {
+        KGG_PROFILE_COUNT(triangles_submitted, 1);
+        if (rasterized) {
+            KGG_PROFILE_COUNT(triangles_rasterized, 1);
+        } else {
+            KGG_PROFILE_COUNT(triangles_culled, 1);
+        }
     }
 
     /**
      * Отрисовка треугольников с помощью условия на нахождение внутри треугольника
      * В который вписан соответствующие координаты
      *
+     * Уравнения рёбер строятся один раз (TriangleSetup), дальше по x и y
+     * значения только наращиваются. Координаты целочисленные (28.4),
+     * общие рёбра соседних треугольников разделяются по top-left правилу
+     *
      * @param framebuffer
      * @param a
      * @param b
@@ -64,44 +69,79 @@ namespace render {
         const gmath::Vector2<float> c,
         const Color &color
         ) {
-        // 1. Bounding box
-        // Получим "квадрат", в которую полностью вписан треугольник
-        const int min_x = static_cast<int>(
-            std::floor(std::min({a.x, b.x, c.x}))
-            );
-        const int max_x = static_cast<int>(
-            std::floor(std::max({a.x, b.x, c.x}))
-            );
-        const int min_y = static_cast<int>(
-            std::floor(std::min({a.y, b.y, c.y}))
-            );
-        const int max_y = static_cast<int>(
-            std::floor(std::max({a.y, b.y, c.y}))
+        draw_triangle(framebuffer, a, b, c, color, full_rect(framebuffer));
+    }
+
+    void Rasterizer::draw_triangle(
+        Framebuffer &framebuffer,
+        const gmath::Vector2<float> a,
+        const gmath::Vector2<float> b,
+        const gmath::Vector2<float> c,
+        const Color &color,
+        const Rect &scissor
+        ) {
+        // 1. Настройка рёбер и bounding box, обрезанный по scissor и экрану
+        const auto setup = TriangleSetup::create(
+            a, b, c,
+            scissor.intersect(full_rect(framebuffer))
             );
+        count_triangle(setup.has_value());
+        if (setup) {
+            fill_triangle(framebuffer, *setup, color);
+        }
+    }
 
-        // 2. Предварительная ориентация
-        const float area = edge(a, b, c);
-        if (area == 0.0f) {
+    void Rasterizer::fill_triangle(
+        Framebuffer &framebuffer,
+        const TriangleSetup &setup,
+        const Color &color
+        ) {
+        framebuffer.mark_dirty(setup.bounds());
+
+        // 2. Векторное ядро (4/8 пикселей за шаг), если значения рёбер помещаются в int32
+        if (simd::fits_int32(setup)) {
+            const std::size_t written = simd::fill_triangle(
+                simd::make_job(setup, framebuffer.get_row(0), framebuffer.get_stride()),
+                color.to_rgba32()
+                );
+            KGG_PROFILE_COUNT(pixels_shaded, written);
             return;
         }
 
-        // 3. Отрисовка треуголька
-        for (int y = min_y; y <= max_y; ++y) {
-            for (int x = min_x; x <= max_x; ++x) {
-                gmath::Vector2<float> pixel(
-                    x + 0.5f,
-                    y + 0.5f
-                );
+        const EdgeFunction& e0 = setup.edges[0];
+        const EdgeFunction& e1 = setup.edges[1];
+        const EdgeFunction& e2 = setup.edges[2];
+
+        std::int64_t w0_row = e0.at_pixel(setup.min_x, setup.min_y);
+        std::int64_t w1_row = e1.at_pixel(setup.min_x, setup.min_y);
+        std::int64_t w2_row = e2.at_pixel(setup.min_x, setup.min_y);
 
-                float w0 = edge(b, c, pixel);
-                float w1 = edge(c, a, pixel);
-                float w2 = edge(a, b, pixel);
+        const std::uint32_t rgba = color.to_rgba32();
+        std::size_t written = 0;
 
-                if ((w0 >= 0 && w1 >= 0 && w2 >= 0) || (w0 <= 0 && w1 <= 0 && w2 <= 0)) {
-                    framebuffer.set_pixel(x, y, color);
+        // 3. Отрисовка треуголька: только сложения на пиксель
+        for (int y = setup.min_y; y <= setup.max_y; ++y) {
+            std::uint32_t* row = framebuffer.get_row(static_cast<uint32_t>(y));
+            std::int64_t w0 = w0_row;
+            std::int64_t w1 = w1_row;
+            std::int64_t w2 = w2_row;
+
+            for (int x = setup.min_x; x <= setup.max_x; ++x) {
+                // Знаковый бит объединения установлен, если хоть одно значение < 0
+                if ((w0 | w1 | w2) >= 0) {
+                    row[x] = rgba;
+                    ++written;
                 }
+                w0 += e0.step_x;
+                w1 += e1.step_x;
+                w2 += e2.step_x;
             }
+
+            w0_row += e0.step_y;
+            w1_row += e1.step_y;
+            w2_row += e2.step_y;
         }
+        KGG_PROFILE_COUNT(pixels_shaded, written);
     }
 
     void Rasterizer::draw_colored_triangle(
@@ -113,45 +153,218 @@ namespace render {
         const Color& color_b,
         const Color& color_c
     ) {
-        const int min_x = static_cast<int>(
-            std::floor(std::min({a.x, b.x, c.x}))
+        draw_colored_triangle(
+            framebuffer, a, b, c,
+            color_a, color_b, color_c,
+            full_rect(framebuffer)
             );
-        const int max_x = static_cast<int>(
-            std::floor(std::max({a.x, b.x, c.x}))
-            );
-        const int min_y = static_cast<int>(
-            std::floor(std::min({a.y, b.y, c.y}))
-            );
-        const int max_y = static_cast<int>(
-            std::floor(std::max({a.y, b.y, c.y}))
+    }
+
+    void Rasterizer::draw_colored_triangle(
+        Framebuffer& framebuffer,
+        const gmath::Vector2<float> a,
+        const gmath::Vector2<float> b,
+        const gmath::Vector2<float> c,
+        const Color& color_a,
+        const Color& color_b,
+        const Color& color_c,
+        const Rect& scissor
+    ) {
+        const auto setup = TriangleSetup::create(
+            a, b, c,
+            scissor.intersect(full_rect(framebuffer))
             );
+        count_triangle(setup.has_value());
+        if (setup) {
+            fill_colored_triangle(framebuffer, *setup, color_a, color_b, color_c);
+        }
+    }
+
+    void Rasterizer::fill_colored_triangle(
+        Framebuffer& framebuffer,
+        const TriangleSetup& setup,
+        const Color& color_a,
+        const Color& color_b,
+        const Color& color_c
+    ) {
+        framebuffer.mark_dirty(setup.bounds());
+
+        // При перестановке b и c меняются местами и их веса
+        const Color& col_b = setup.swapped ? color_c : color_b;
+        const Color& col_c = setup.swapped ? color_b : color_c;
+
+        // Одно деление на треугольник вместо трёх на пиксель
+        const float inv_area = 1.0f / static_cast<float>(setup.area);
 
-        const float area = edge(a, b, c);
-        if (area == 0.0f) {
+        if (simd::fits_int32(setup)) {
+            const float colors[3][4] = {
+                {float(color_a.r), float(color_a.g), float(color_a.b), float(color_a.a)},
+                {float(col_b.r), float(col_b.g), float(col_b.b), float(col_b.a)},
+                {float(col_c.r), float(col_c.g), float(col_c.b), float(col_c.a)}
+            };
+            const std::size_t written = simd::fill_colored_triangle(
+                simd::make_job(setup, framebuffer.get_row(0), framebuffer.get_stride()),
+                inv_area,
+                colors
+                );
+            KGG_PROFILE_COUNT(pixels_shaded, written);
             return;
         }
 
-        for (int y = min_y; y <= max_y; ++y) {
-            for (int x = min_x; x <= max_x; ++x) {
-                gmath::Vector2<float> pixel(x + 0.5f, y + 0.5f);
-
-                float w0 = edge(b, c, pixel);
-                float w1 = edge(c, a, pixel);
-                float w2 = edge(a, b, pixel);
-
-                if ((w0 >= 0 && w1 >= 0 && w2 >= 0) || (w0 <= 0 && w1 <= 0 && w2 <= 0)) {
-                    //framebuffer.set_pixel(x, y, color);
-                    float alpha = w0 / area;
-                    float beta = w1 / area;
-                    float gamma = w2 / area;
-
-                    Color result = interpolate_color(
-                        alpha, beta, gamma,
-                        color_a, color_b, color_c
-                        );
-                    framebuffer.set_pixel(x, y, result);
+        // Плоскости цвета строятся один раз, на пиксель — только сложения
+        const ColorInterpolator::Values values[3] = {to_values(color_a), to_values(color_b), to_values(color_c)};
+        const ColorInterpolator interpolator(setup, values);
+
+        const EdgeFunction& e0 = setup.edges[0];
+        const EdgeFunction& e1 = setup.edges[1];
+        const EdgeFunction& e2 = setup.edges[2];
+
+        std::int64_t w0_row = e0.at_pixel(setup.min_x, setup.min_y);
+        std::int64_t w1_row = e1.at_pixel(setup.min_x, setup.min_y);
+        std::int64_t w2_row = e2.at_pixel(setup.min_x, setup.min_y);
+        std::size_t written = 0;
+
+        for (int y = setup.min_y; y <= setup.max_y; ++y) {
+            std::uint32_t* row = framebuffer.get_row(static_cast<uint32_t>(y));
+            std::int64_t w0 = w0_row;
+            std::int64_t w1 = w1_row;
+            std::int64_t w2 = w2_row;
+            auto color = interpolator.at(setup.min_x, y);
+
+            for (int x = setup.min_x; x <= setup.max_x; ++x) {
+                if ((w0 | w1 | w2) >= 0) {
+                    row[x] = to_color(color.get()).to_rgba32();
+                    ++written;
                 }
+                w0 += e0.step_x;
+                w1 += e1.step_x;
+                w2 += e2.step_x;
+                color.step();
             }
+
+            w0_row += e0.step_y;
+            w1_row += e1.step_y;
+            w2_row += e2.step_y;
+        }
+        KGG_PROFILE_COUNT(pixels_shaded, written);
+    }
+
+    // Источники цвета для fill_depth_triangle (Render/FragmentLoop.h)
+    struct FlatFragments {
+        struct Row {
+            std::uint32_t rgba;
+
+            void step() {}
+            [[nodiscard]] std::uint32_t shade() const { return rgba; }
+        };
+
+        std::uint32_t rgba;
+
+        [[nodiscard]] Row row(int, int) const { return {rgba}; }
+    };
+
+    struct ColorFragments {
+        struct Row {
+            ColorInterpolator::Cursor color;
+
+            void step() { color.step(); }
+            [[nodiscard]] std::uint32_t shade() const { return to_color(color.get()).to_rgba32(); }
+        };
+
+        ColorInterpolator interpolator;
+
+        [[nodiscard]] Row row(int x, int y) const { return {interpolator.at(x, y)}; }
+    };
+
+    void Rasterizer::draw_triangle(
+        Framebuffer& framebuffer,
+        const gmath::Vector3<float>& a,
+        const gmath::Vector3<float>& b,
+        const gmath::Vector3<float>& c,
+        const Color& color
+    ) {
+        const auto setup = TriangleSetup::create(
+            {a.x, a.y}, {b.x, b.y}, {c.x, c.y},
+            full_rect(framebuffer)
+            );
+        count_triangle(setup.has_value());
+        if (setup) {
+            const float depth[3] = {a.z, b.z, c.z};
+            fill_triangle(framebuffer, *setup, depth, color);
+        }
+    }
+
+    void Rasterizer::draw_colored_triangle(
+        Framebuffer& framebuffer,
+        const gmath::Vector3<float>& a,
+        const gmath::Vector3<float>& b,
+        const gmath::Vector3<float>& c,
+        const Color& color_a,
+        const Color& color_b,
+        const Color& color_c
+    ) {
+        const auto setup = TriangleSetup::create(
+            {a.x, a.y}, {b.x, b.y}, {c.x, c.y},
+            full_rect(framebuffer)
+            );
+        count_triangle(setup.has_value());
+        if (setup) {
+            const float depth[3] = {a.z, b.z, c.z};
+            fill_colored_triangle(framebuffer, *setup, depth, color_a, color_b, color_c);
         }
     }
+
+    void Rasterizer::fill_triangle(
+        Framebuffer& framebuffer,
+        const TriangleSetup& setup,
+        const float depth[3],
+        const Color& color
+    ) {
+        fill_depth_triangle(framebuffer, setup, depth, FlatFragments{color.to_rgba32()});
+    }
+
+    void Rasterizer::fill_colored_triangle(
+        Framebuffer& framebuffer,
+        const TriangleSetup& setup,
+        const float depth[3],
+        const Color& color_a,
+        const Color& color_b,
+        const Color& color_c
+    ) {
+        fill_colored_triangle(framebuffer, setup, depth, nullptr, color_a, color_b, color_c);
+    }
+
+    void Rasterizer::draw_colored_triangle(
+        Framebuffer& framebuffer,
+        const ScreenVertex& a,
+        const ScreenVertex& b,
+        const ScreenVertex& c,
+        const Color& color_a,
+        const Color& color_b,
+        const Color& color_c
+    ) {
+        const auto setup = TriangleSetup::create(
+            {a.position.x, a.position.y}, {b.position.x, b.position.y}, {c.position.x, c.position.y},
+            full_rect(framebuffer)
+            );
+        count_triangle(setup.has_value());
+        if (setup) {
+            const float depth[3] = {a.position.z, b.position.z, c.position.z};
+            const float inv_w[3] = {a.inv_w, b.inv_w, c.inv_w};
+            fill_colored_triangle(framebuffer, *setup, depth, inv_w, color_a, color_b, color_c);
+        }
+    }
+
+    void Rasterizer::fill_colored_triangle(
+        Framebuffer& framebuffer,
+        const TriangleSetup& setup,
+        const float depth[3],
+        const float inv_w[3],
+        const Color& color_a,
+        const Color& color_b,
+        const Color& color_c
+    ) {
+        const ColorInterpolator::Values values[3] = {to_values(color_a), to_values(color_b), to_values(color_c)};
+        fill_depth_triangle(framebuffer, setup, depth, ColorFragments{ColorInterpolator(setup, values, inv_w)});
+    }
 }
@@ -0,0 +1,433 @@
+//
+// Created by shulz on 18.12.2025.
+//
+
+#include "Render/RasterizerSimd.h"
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <limits>
+
+#if defined(__x86_64__) || defined(_M_X64)
+    #define KGG_SIMD_X86 1
+    #include <immintrin.h>
+    #if defined(_MSC_VER) && !defined(__clang__)
+        #include <intrin.h>
+        #define KGG_TARGET_AVX2
+    #else
+        #define KGG_TARGET_AVX2 __attribute__((target("avx2")))
+    #endif
+#else
+    #define KGG_SIMD_X86 0
+#endif
+
+namespace render::simd {
+    namespace {
+        constexpr int NO_FORCED_ISA = -1;
+        std::atomic<int> g_forced_isa{NO_FORCED_ISA};
+
+        inline std::uint32_t shade_pixel(
+            float alpha,
+            float beta,
+            float gamma,
+            const float colors[3][4]
+        ) {
+            std::uint32_t rgba = 0;
+            for (int channel = 0; channel < 4; ++channel) {
+                float v = alpha * colors[0][channel] + beta * colors[1][channel] + gamma * colors[2][channel];
+                v = std::min(std::max(v, 0.0f), 255.0f);
+                rgba |= static_cast<std::uint32_t>(static_cast<std::int32_t>(v)) << (channel * 8);
+            }
+            return rgba;
+        }
+
+        // ---------- Скалярный путь ----------
+
+        std::size_t fill_scalar(const TriangleJob& job, std::uint32_t rgba) {
+            std::size_t written = 0;
+            std::int32_t w0_row = job.w_row[0];
+            std::int32_t w1_row = job.w_row[1];
+            std::int32_t w2_row = job.w_row[2];
+
+            for (int y = job.min_y; y <= job.max_y; ++y) {
+                std::uint32_t* row = job.pixels + static_cast<std::size_t>(y) * job.stride;
+                std::int32_t w0 = w0_row;
+                std::int32_t w1 = w1_row;
+                std::int32_t w2 = w2_row;
+
+                for (int x = job.min_x; x <= job.max_x; ++x) {
+                    if ((w0 | w1 | w2) >= 0) {
+                        row[x] = rgba;
+                        ++written;
+                    }
+                    w0 += job.step_x[0];
+                    w1 += job.step_x[1];
+                    w2 += job.step_x[2];
+                }
+
+                w0_row += job.step_y[0];
+                w1_row += job.step_y[1];
+                w2_row += job.step_y[2];
+            }
+            return written;
+        }
+
+        std::size_t fill_colored_scalar(const TriangleJob& job, float inv_area, const float colors[3][4]) {
+            std::size_t written = 0;
+            std::int32_t w0_row = job.w_row[0];
+            std::int32_t w1_row = job.w_row[1];
+            std::int32_t w2_row = job.w_row[2];
+
+            for (int y = job.min_y; y <= job.max_y; ++y) {
+                std::uint32_t* row = job.pixels + static_cast<std::size_t>(y) * job.stride;
+                std::int32_t w0 = w0_row;
+                std::int32_t w1 = w1_row;
+                std::int32_t w2 = w2_row;
+
+                for (int x = job.min_x; x <= job.max_x; ++x) {
+                    if ((w0 | w1 | w2) >= 0) {
+                        row[x] = shade_pixel(
+                            static_cast<float>(w0) * inv_area,
+                            static_cast<float>(w1) * inv_area,
+                            static_cast<float>(w2) * inv_area,
+                            colors
+                            );
+                        ++written;
+                    }
+                    w0 += job.step_x[0];
+                    w1 += job.step_x[1];
+                    w2 += job.step_x[2];
+                }
+
+                w0_row += job.step_y[0];
+                w1_row += job.step_y[1];
+                w2_row += job.step_y[2];
+            }
+            return written;
+        }
+
+#if KGG_SIMD_X86
+        // ---------- SSE2: 4 пикселя ----------
+        // Полные группы пишутся как load / blend / store, хвост (< 4 пикселей) — скалярно,
+        // чтобы не трогать память за пределами [min_x, max_x]
+
+        inline __m128i sse2_pack(__m128 r, __m128 g, __m128 b, __m128 a) {
+            const __m128 zero = _mm_setzero_ps();
+            const __m128 max = _mm_set1_ps(255.0f);
+            __m128i ri = _mm_cvttps_epi32(_mm_min_ps(_mm_max_ps(r, zero), max));
+            __m128i gi = _mm_cvttps_epi32(_mm_min_ps(_mm_max_ps(g, zero), max));
+            __m128i bi = _mm_cvttps_epi32(_mm_min_ps(_mm_max_ps(b, zero), max));
+            __m128i ai = _mm_cvttps_epi32(_mm_min_ps(_mm_max_ps(a, zero), max));
+            return _mm_or_si128(
+                _mm_or_si128(ri, _mm_slli_epi32(gi, 8)),
+                _mm_or_si128(_mm_slli_epi32(bi, 16), _mm_slli_epi32(ai, 24))
+            );
+        }
+
+        inline void sse2_store_masked(std::uint32_t* dst, __m128i mask, __m128i value) {
+            const int bits = _mm_movemask_ps(_mm_castsi128_ps(mask));
+            if (bits == 0) {
+                return;
+            }
+            if (bits == 0xF) {
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), value);
+                return;
+            }
+            __m128i old = _mm_loadu_si128(reinterpret_cast<const __m128i*>(dst));
+            _mm_storeu_si128(
+                reinterpret_cast<__m128i*>(dst),
+                _mm_or_si128(_mm_and_si128(mask, value), _mm_andnot_si128(mask, old))
+            );
+        }
+
+        template<typename Shade>
+        std::size_t sse2_walk(const TriangleJob& job, Shade&& shade) {
+            std::size_t written = 0;
+            __m128i lane_offset[3];
+            __m128i step4[3];
+            for (int i = 0; i < 3; ++i) {
+                const std::int32_t s = job.step_x[i];
+                lane_offset[i] = _mm_setr_epi32(0, s, 2 * s, 3 * s);
+                step4[i] = _mm_set1_epi32(4 * s);
+            }
+            const __m128i minus_one = _mm_set1_epi32(-1);
+
+            std::int32_t w_row[3] = {job.w_row[0], job.w_row[1], job.w_row[2]};
+
+            for (int y = job.min_y; y <= job.max_y; ++y) {
+                std::uint32_t* row = job.pixels + static_cast<std::size_t>(y) * job.stride;
+                __m128i w0 = _mm_add_epi32(_mm_set1_epi32(w_row[0]), lane_offset[0]);
+                __m128i w1 = _mm_add_epi32(_mm_set1_epi32(w_row[1]), lane_offset[1]);
+                __m128i w2 = _mm_add_epi32(_mm_set1_epi32(w_row[2]), lane_offset[2]);
+
+                int x = job.min_x;
+                for (; x + 3 <= job.max_x; x += 4) {
+                    const __m128i mask = _mm_cmpgt_epi32(_mm_or_si128(_mm_or_si128(w0, w1), w2), minus_one);
+                    const int bits = _mm_movemask_ps(_mm_castsi128_ps(mask));
+                    if (bits != 0) {
+                        sse2_store_masked(row + x, mask, shade(w0, w1, w2));
+                        written += static_cast<std::size_t>(std::popcount(static_cast<unsigned>(bits)));
+                    }
+                    w0 = _mm_add_epi32(w0, step4[0]);
+                    w1 = _mm_add_epi32(w1, step4[1]);
+                    w2 = _mm_add_epi32(w2, step4[2]);
+                }
+
+                if (x <= job.max_x) {
+                    alignas(16) std::int32_t t0[4], t1[4], t2[4], px[4];
+                    _mm_store_si128(reinterpret_cast<__m128i*>(t0), w0);
+                    _mm_store_si128(reinterpret_cast<__m128i*>(t1), w1);
+                    _mm_store_si128(reinterpret_cast<__m128i*>(t2), w2);
+                    _mm_store_si128(reinterpret_cast<__m128i*>(px), shade(w0, w1, w2));
+                    for (int lane = 0; x <= job.max_x; ++x, ++lane) {
+                        if ((t0[lane] | t1[lane] | t2[lane]) >= 0) {
+                            row[x] = static_cast<std::uint32_t>(px[lane]);
+                            ++written;
+                        }
+                    }
+                }
+
+                for (int i = 0; i < 3; ++i) {
+                    w_row[i] += job.step_y[i];
+                }
+            }
+            return written;
+        }
+
+        std::size_t fill_sse2(const TriangleJob& job, std::uint32_t rgba) {
+            const __m128i color = _mm_set1_epi32(static_cast<std::int32_t>(rgba));
+            return sse2_walk(job, [color](__m128i, __m128i, __m128i) { return color; });
+        }
+
+        std::size_t fill_colored_sse2(const TriangleJob& job, float inv_area, const float colors[3][4]) {
+            const __m128 inv = _mm_set1_ps(inv_area);
+            __m128 c[3][4];
+            for (int v = 0; v < 3; ++v) {
+                for (int ch = 0; ch < 4; ++ch) {
+                    c[v][ch] = _mm_set1_ps(colors[v][ch]);
+                }
+            }
+
+            return sse2_walk(job, [&](__m128i w0, __m128i w1, __m128i w2) {
+                const __m128 alpha = _mm_mul_ps(_mm_cvtepi32_ps(w0), inv);
+                const __m128 beta = _mm_mul_ps(_mm_cvtepi32_ps(w1), inv);
+                const __m128 gamma = _mm_mul_ps(_mm_cvtepi32_ps(w2), inv);
+                __m128 ch[4];
+                for (int i = 0; i < 4; ++i) {
+                    ch[i] = _mm_add_ps(
+                        _mm_add_ps(_mm_mul_ps(alpha, c[0][i]), _mm_mul_ps(beta, c[1][i])),
+                        _mm_mul_ps(gamma, c[2][i])
+                    );
+                }
+                return sse2_pack(ch[0], ch[1], ch[2], ch[3]);
+            });
+        }
+
+        // ---------- AVX2: 8 пикселей ----------
+        // vpmaskmovd не трогает память выключенных линий, поэтому хвост тоже векторный
+
+        KGG_TARGET_AVX2 inline __m256i avx2_pack(__m256 r, __m256 g, __m256 b, __m256 a) {
+            const __m256 zero = _mm256_setzero_ps();
+            const __m256 max = _mm256_set1_ps(255.0f);
+            __m256i ri = _mm256_cvttps_epi32(_mm256_min_ps(_mm256_max_ps(r, zero), max));
+            __m256i gi = _mm256_cvttps_epi32(_mm256_min_ps(_mm256_max_ps(g, zero), max));
+            __m256i bi = _mm256_cvttps_epi32(_mm256_min_ps(_mm256_max_ps(b, zero), max));
+            __m256i ai = _mm256_cvttps_epi32(_mm256_min_ps(_mm256_max_ps(a, zero), max));
+            return _mm256_or_si256(
+                _mm256_or_si256(ri, _mm256_slli_epi32(gi, 8)),
+                _mm256_or_si256(_mm256_slli_epi32(bi, 16), _mm256_slli_epi32(ai, 24))
+            );
+        }
+
+        template<typename Shade>
+        KGG_TARGET_AVX2 std::size_t avx2_walk(const TriangleJob& job, Shade&& shade) {
+            std::size_t written = 0;
+            const __m256i lane = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+            __m256i lane_offset[3];
+            __m256i step8[3];
+            for (int i = 0; i < 3; ++i) {
+                lane_offset[i] = _mm256_mullo_epi32(lane, _mm256_set1_epi32(job.step_x[i]));
+                step8[i] = _mm256_set1_epi32(8 * job.step_x[i]);
+            }
+            const __m256i minus_one = _mm256_set1_epi32(-1);
+
+            std::int32_t w_row[3] = {job.w_row[0], job.w_row[1], job.w_row[2]};
+
+            for (int y = job.min_y; y <= job.max_y; ++y) {
+                std::uint32_t* row = job.pixels + static_cast<std::size_t>(y) * job.stride;
+                __m256i w0 = _mm256_add_epi32(_mm256_set1_epi32(w_row[0]), lane_offset[0]);
+                __m256i w1 = _mm256_add_epi32(_mm256_set1_epi32(w_row[1]), lane_offset[1]);
+                __m256i w2 = _mm256_add_epi32(_mm256_set1_epi32(w_row[2]), lane_offset[2]);
+
+                for (int x = job.min_x; x <= job.max_x; x += 8) {
+                    __m256i mask = _mm256_cmpgt_epi32(
+                        _mm256_or_si256(_mm256_or_si256(w0, w1), w2), minus_one
+                        );
+                    const int remaining = job.max_x - x + 1;
+                    if (remaining < 8) {
+                        mask = _mm256_and_si256(mask, _mm256_cmpgt_epi32(_mm256_set1_epi32(remaining), lane));
+                    }
+                    if (!_mm256_testz_si256(mask, mask)) {
+                        _mm256_maskstore_epi32(
+                            reinterpret_cast<int*>(row + x),
+                            mask,
+                            shade(w0, w1, w2)
+                            );
+                        written += static_cast<std::size_t>(
+                            std::popcount(static_cast<unsigned>(_mm256_movemask_ps(_mm256_castsi256_ps(mask)))));
+                    }
+                    w0 = _mm256_add_epi32(w0, step8[0]);
+                    w1 = _mm256_add_epi32(w1, step8[1]);
+                    w2 = _mm256_add_epi32(w2, step8[2]);
+                }
+
+                for (int i = 0; i < 3; ++i) {
+                    w_row[i] += job.step_y[i];
+                }
+            }
+            return written;
+        }
+
+        KGG_TARGET_AVX2 std::size_t fill_avx2(const TriangleJob& job, std::uint32_t rgba) {
+            const __m256i color = _mm256_set1_epi32(static_cast<std::int32_t>(rgba));
+            return avx2_walk(job, [color](__m256i, __m256i, __m256i) KGG_TARGET_AVX2 { return color; });
+        }
+
+        KGG_TARGET_AVX2 std::size_t fill_colored_avx2(const TriangleJob& job, float inv_area, const float colors[3][4]) {
+            const __m256 inv = _mm256_set1_ps(inv_area);
+            __m256 c[3][4];
+            for (int v = 0; v < 3; ++v) {
+                for (int ch = 0; ch < 4; ++ch) {
+                    c[v][ch] = _mm256_set1_ps(colors[v][ch]);
+                }
+            }
+
+            return avx2_walk(job, [&](__m256i w0, __m256i w1, __m256i w2) KGG_TARGET_AVX2 {
+                const __m256 alpha = _mm256_mul_ps(_mm256_cvtepi32_ps(w0), inv);
+                const __m256 beta = _mm256_mul_ps(_mm256_cvtepi32_ps(w1), inv);
+                const __m256 gamma = _mm256_mul_ps(_mm256_cvtepi32_ps(w2), inv);
+                __m256 ch[4];
+                for (int i = 0; i < 4; ++i) {
+                    ch[i] = _mm256_add_ps(
+                        _mm256_add_ps(_mm256_mul_ps(alpha, c[0][i]), _mm256_mul_ps(beta, c[1][i])),
+                        _mm256_mul_ps(gamma, c[2][i])
+                    );
+                }
+                return avx2_pack(ch[0], ch[1], ch[2], ch[3]);
+            });
+        }
+#endif
+    }
+
+    Isa detect_isa() {
+        static const Isa detected = [] {
+#if KGG_SIMD_X86
+    #if defined(_MSC_VER) && !defined(__clang__)
+            int info[4];
+            __cpuid(info, 0);
+            const int max_leaf = info[0];
+            __cpuid(info, 1);
+            const bool os_avx = (info[2] & (1 << 27)) && (info[2] & (1 << 28))
+                             && (_xgetbv(0) & 0x6) == 0x6;
+            if (os_avx && max_leaf >= 7) {
+                __cpuidex(info, 7, 0);
+                if (info[1] & (1 << 5)) {
+                    return Isa::avx2;
+                }
+            }
+            return Isa::sse2;
+    #else
+            __builtin_cpu_init();
+            if (__builtin_cpu_supports("avx2")) {
+                return Isa::avx2;
+            }
+            return Isa::sse2;
+    #endif
+#else
+            return Isa::scalar;
+#endif
+        }();
+        return detected;
+    }
+
+    Isa active_isa() {
+        const int forced = g_forced_isa.load(std::memory_order_relaxed);
+        const Isa detected = detect_isa();
+        if (forced == NO_FORCED_ISA || forced > static_cast<int>(detected)) {
+            return detected;
+        }
+        return static_cast<Isa>(forced);
+    }
+
+    void force_isa(Isa isa) {
+        g_forced_isa.store(static_cast<int>(isa), std::memory_order_relaxed);
+    }
+
+    bool fits_int32(const TriangleSetup& setup) {
+        constexpr std::int64_t limit = std::numeric_limits<std::int32_t>::max();
+
+        for (const EdgeFunction& e : setup.edges) {
+            // Запас на перешагивание за последний пиксель группы и строки
+            const std::int64_t margin = 8 * std::abs(e.step_x) + std::abs(e.step_y);
+            if (margin > limit) {
+                return false;
+            }
+            const std::int64_t corners[4] = {
+                e.at_pixel(setup.min_x, setup.min_y),
+                e.at_pixel(setup.max_x, setup.min_y),
+                e.at_pixel(setup.min_x, setup.max_y),
+                e.at_pixel(setup.max_x, setup.max_y)
+            };
+            for (std::int64_t v : corners) {
+                if (std::abs(v) > limit - margin) {
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+
+    TriangleJob make_job(const TriangleSetup& setup, std::uint32_t* pixels, std::size_t stride) {
+        TriangleJob job{};
+        job.pixels = pixels;
+        job.stride = stride;
+        job.min_x = setup.min_x;
+        job.max_x = setup.max_x;
+        job.min_y = setup.min_y;
+        job.max_y = setup.max_y;
+        for (int i = 0; i < 3; ++i) {
+            const EdgeFunction& e = setup.edges[i];
+            job.w_row[i] = static_cast<std::int32_t>(e.at_pixel(setup.min_x, setup.min_y));
+            job.step_x[i] = static_cast<std::int32_t>(e.step_x);
+            job.step_y[i] = static_cast<std::int32_t>(e.step_y);
+        }
+        return job;
+    }
+
+    std::size_t fill_triangle(const TriangleJob& job, std::uint32_t rgba) {
+        switch (active_isa()) {
+#if KGG_SIMD_X86
+            case Isa::avx2:
+                return fill_avx2(job, rgba);
+            case Isa::sse2:
+                return fill_sse2(job, rgba);
+#endif
+            default:
+                return fill_scalar(job, rgba);
+        }
+    }
+
+    std::size_t fill_colored_triangle(const TriangleJob& job, float inv_area, const float colors[3][4]) {
+        switch (active_isa()) {
+#if KGG_SIMD_X86
+            case Isa::avx2:
+                return fill_colored_avx2(job, inv_area, colors);
+            case Isa::sse2:
+                return fill_colored_sse2(job, inv_area, colors);
+#endif
+            default:
+                return fill_colored_scalar(job, inv_area, colors);
+        }
+    }
+}
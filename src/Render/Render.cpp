@@ -0,0 +1,43 @@
+//
+// Created by lunarimoonlin on 12/14/25.
+//
+
+#include <Render/Render.h>
+
+#include "Render/Clipper.h"
+#include "Render/Mesh.h"
+#include "Render/TiledRenderer.h"
+#include "Render/VertexStage.h"
+
+void Render::render(
+    const Mesh& mesh,
+    const gmath::Matrix4<float>& mvp,
+    const render::Clipper& clipper,
+    render::VertexStage& stage,
+    render::TiledRenderer& target,
+    const render::Color& color
+) {
+    stage.process(mesh, mvp, clipper);
+
+    const auto indices = mesh.indices();
+    for (std::size_t i = 0; i + 2 < indices.size(); i += 3) {
+        const std::uint32_t a = indices[i];
+        const std::uint32_t b = indices[i + 1];
+        const std::uint32_t c = indices[i + 2];
+
+        if (!stage.needs_clipping(a) && !stage.needs_clipping(b) && !stage.needs_clipping(c)) {
+            target.draw_triangle(stage.screen(a), stage.screen(b), stage.screen(c), color);
+            continue;
+        }
+
+        const render::Clipper::Polygon polygon = clipper.clip_triangle(stage.clip(a), stage.clip(b), stage.clip(c));
+        for (int k = 1; k + 1 < polygon.count; ++k) {
+            target.draw_triangle(
+                polygon.vertices[0].position,
+                polygon.vertices[k].position,
+                polygon.vertices[k + 1].position,
+                color
+            );
+        }
+    }
+}
@@ -0,0 +1,196 @@
+//
+// Created by shulz on 18.12.2025.
+//
+
+#include "Render/TiledRenderer.h"
+
+#include "Profile/Profiler.h"
+#include "Render/Rasterizer.h"
+
+namespace render {
+    TiledRenderer::TiledRenderer(ThreadPool& pool)
+        : m_pool(pool)
+    {}
+
+    void TiledRenderer::begin_frame(Framebuffer& framebuffer) {
+        m_target = &framebuffer;
+        m_tiles_x = (static_cast<int>(framebuffer.get_width()) + TILE_SIZE - 1) / TILE_SIZE;
+        m_tiles_y = (static_cast<int>(framebuffer.get_height()) + TILE_SIZE - 1) / TILE_SIZE;
+
+        m_commands.clear();
+        m_submitted = 0;
+        // Корзины очищаются без освобождения памяти: размер кадра обычно не меняется
+        m_bins.resize(static_cast<size_t>(m_tiles_x) * m_tiles_y);
+        for (auto& bin : m_bins) {
+            bin.clear();
+        }
+    }
+
+    Rect TiledRenderer::tile_rect(int tile_x, int tile_y) const {
+        const Rect tile{
+            tile_x * TILE_SIZE,
+            tile_y * TILE_SIZE,
+            (tile_x + 1) * TILE_SIZE,
+            (tile_y + 1) * TILE_SIZE
+        };
+        return tile.intersect(target_rect());
+    }
+
+    Rect TiledRenderer::target_rect() const {
+        return {
+            0, 0,
+            static_cast<int>(m_target->get_width()),
+            static_cast<int>(m_target->get_height())
+        };
+    }
+
+    void TiledRenderer::draw_triangle(
+        const gmath::Vector2<float>& a,
+        const gmath::Vector2<float>& b,
+        const gmath::Vector2<float>& c,
+        const Color& color
+    ) {
+        const auto setup = TriangleSetup::create(a, b, c, target_rect());
+        ++m_submitted;
+        if (setup) {
+            bin({*setup, {color, color, color}, {}, {1.0f, 1.0f, 1.0f}, false, false});
+        }
+    }
+
+    void TiledRenderer::draw_colored_triangle(
+        const gmath::Vector2<float>& a,
+        const gmath::Vector2<float>& b,
+        const gmath::Vector2<float>& c,
+        const Color& color_a,
+        const Color& color_b,
+        const Color& color_c
+    ) {
+        const auto setup = TriangleSetup::create(a, b, c, target_rect());
+        ++m_submitted;
+        if (setup) {
+            bin({*setup, {color_a, color_b, color_c}, {}, {1.0f, 1.0f, 1.0f}, true, false});
+        }
+    }
+
+    void TiledRenderer::draw_triangle(
+        const gmath::Vector3<float>& a,
+        const gmath::Vector3<float>& b,
+        const gmath::Vector3<float>& c,
+        const Color& color
+    ) {
+        const auto setup = TriangleSetup::create({a.x, a.y}, {b.x, b.y}, {c.x, c.y}, target_rect());
+        ++m_submitted;
+        if (setup) {
+            bin({*setup, {color, color, color}, {a.z, b.z, c.z}, {1.0f, 1.0f, 1.0f}, false, true});
+        }
+    }
+
+    void TiledRenderer::draw_colored_triangle(
+        const gmath::Vector3<float>& a,
+        const gmath::Vector3<float>& b,
+        const gmath::Vector3<float>& c,
+        const Color& color_a,
+        const Color& color_b,
+        const Color& color_c
+    ) {
+        const auto setup = TriangleSetup::create({a.x, a.y}, {b.x, b.y}, {c.x, c.y}, target_rect());
+        ++m_submitted;
+        if (setup) {
+            bin({*setup, {color_a, color_b, color_c}, {a.z, b.z, c.z}, {1.0f, 1.0f, 1.0f}, true, true});
+        }
+    }
+
+    void TiledRenderer::draw_colored_triangle(
+        const ScreenVertex& a,
+        const ScreenVertex& b,
+        const ScreenVertex& c,
+        const Color& color_a,
+        const Color& color_b,
+        const Color& color_c
+    ) {
+        const auto setup = TriangleSetup::create(
+            {a.position.x, a.position.y}, {b.position.x, b.position.y}, {c.position.x, c.position.y},
+            target_rect()
+            );
+        ++m_submitted;
+        if (setup) {
+            bin({
+                *setup,
+                {color_a, color_b, color_c},
+                {a.position.z, b.position.z, c.position.z},
+                {a.inv_w, b.inv_w, c.inv_w},
+                true, true
+            });
+        }
+    }
+
+    void TiledRenderer::bin(const Command& command) {
+        const auto index = static_cast<std::uint32_t>(m_commands.size());
+        m_commands.push_back(command);
+
+        const TriangleSetup& setup = command.setup;
+        const int tx0 = setup.min_x / TILE_SIZE;
+        const int tx1 = setup.max_x / TILE_SIZE;
+        const int ty0 = setup.min_y / TILE_SIZE;
+        const int ty1 = setup.max_y / TILE_SIZE;
+        const bool single_tile = tx0 == tx1 && ty0 == ty1;
+
+        for (int ty = ty0; ty <= ty1; ++ty) {
+            for (int tx = tx0; tx <= tx1; ++tx) {
+                // Тайлы bounding box, которые треугольник заведомо не задевает, пропускаются
+                if (!single_tile && !setup.may_cover(tile_rect(tx, ty))) {
+                    continue;
+                }
+                m_bins[static_cast<size_t>(ty) * m_tiles_x + tx].push_back(index);
+            }
+        }
+    }
+
+    void TiledRenderer::end_frame() {
+        KGG_PROFILE_COUNT(triangles_submitted, m_submitted);
+        KGG_PROFILE_COUNT(triangles_culled, m_submitted - m_commands.size());
+        KGG_PROFILE_COUNT(triangles_rasterized, m_commands.size());
+        KGG_PROFILE_SCOPE(raster);
+
+        m_active_tiles.clear();
+        for (size_t i = 0; i < m_bins.size(); ++i) {
+            if (!m_bins[i].empty()) {
+                m_active_tiles.push_back(static_cast<std::uint32_t>(i));
+            }
+        }
+
+        m_pool.parallel_for(m_active_tiles.size(), [this](size_t task) {
+            KGG_PROFILE_SCOPE(tile);
+            const std::uint32_t tile = m_active_tiles[task];
+            const Rect rect = tile_rect(
+                static_cast<int>(tile % m_tiles_x),
+                static_cast<int>(tile / m_tiles_x)
+                );
+
+            for (const std::uint32_t index : m_bins[tile]) {
+                const Command& command = m_commands[index];
+                const auto clipped = command.setup.clipped(rect);
+                if (!clipped) {
+                    continue;
+                }
+                if (command.depth_test && command.colored) {
+                    Rasterizer::fill_colored_triangle(
+                        *m_target, *clipped, command.depth, command.inv_w,
+                        command.colors[0], command.colors[1], command.colors[2]
+                        );
+                } else if (command.depth_test) {
+                    Rasterizer::fill_triangle(*m_target, *clipped, command.depth, command.colors[0]);
+                } else if (command.colored) {
+                    Rasterizer::fill_colored_triangle(
+                        *m_target, *clipped,
+                        command.colors[0], command.colors[1], command.colors[2]
+                        );
+                } else {
+                    Rasterizer::fill_triangle(*m_target, *clipped, command.colors[0]);
+                }
+            }
+        });
+
+        m_target = nullptr;
+    }
+}
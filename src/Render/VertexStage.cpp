@@ -0,0 +1,96 @@
+//
+// Created by shulz on 18.12.2025.
+//
+
+#include "Render/VertexStage.h"
+
+#include <algorithm>
+#include <stdexcept>
+
+#include "Math/Transform.hpp"
+#include "Profile/Profiler.h"
+#include "Render/Mesh.h"
+
+namespace render {
+    VertexStage::VertexStage(ThreadPool& pool)
+        : m_pool(pool)
+    {}
+
+    void VertexStage::process(const Mesh& mesh, const gmath::Matrix4<float>& mvp, const Clipper& clipper) {
+        process(mesh.x(), mesh.y(), mesh.z(), mvp, clipper);
+    }
+
+    void VertexStage::process(
+        std::span<const float> x,
+        std::span<const float> y,
+        std::span<const float> z,
+        const gmath::Matrix4<float>& mvp,
+        const Clipper& clipper
+    ) {
+        KGG_PROFILE_SCOPE(transform);
+        if (y.size() != x.size() || z.size() != x.size()) {
+            throw std::invalid_argument("Position streams have different sizes");
+        }
+
+        const std::size_t count = x.size();
+        for (Stream* stream : {&m_clipX, &m_clipY, &m_clipZ, &m_clipW, &m_screenX, &m_screenY, &m_depth, &m_invW}) {
+            stream->resize(count);
+        }
+        m_needsClipping.resize(count);
+
+        const std::size_t blocks = (count + BLOCK_SIZE - 1) / BLOCK_SIZE;
+        if (blocks <= 1) {
+            process_block(x.data(), y.data(), z.data(), 0, count, mvp, clipper);
+            return;
+        }
+        m_pool.parallel_for(blocks, [&](std::size_t block) {
+            const std::size_t begin = block * BLOCK_SIZE;
+            process_block(x.data(), y.data(), z.data(), begin, std::min(begin + BLOCK_SIZE, count), mvp, clipper);
+        });
+    }
+
+    void VertexStage::process_block(
+        const float* x, const float* y, const float* z,
+        std::size_t begin, std::size_t end,
+        const gmath::Matrix4<float>& mvp,
+        const Clipper& clipper
+    ) {
+        const std::size_t count = end - begin;
+
+        // 1. Clip space
+        gmath::batch::transform_points(
+            mvp, x + begin, y + begin, z + begin, count,
+            m_clipX.data() + begin, m_clipY.data() + begin, m_clipZ.data() + begin, m_clipW.data() + begin
+        );
+
+        // 2. Деление на w, viewport, флаги отсечения. Цикл без ветвлений — векторизуется
+        const Viewport& viewport = clipper.get_viewport();
+        const float band = clipper.get_guard_band();
+        const float* cx = m_clipX.data();
+        const float* cy = m_clipY.data();
+        const float* cz = m_clipZ.data();
+        const float* cw = m_clipW.data();
+
+        for (std::size_t i = begin; i < end; ++i) {
+            const float w = cw[i];
+            const float inv_w = 1.0f / w;
+            const float ndc_x = cx[i] * inv_w;
+            const float ndc_y = cy[i] * inv_w;
+            const float ndc_z = cz[i] * inv_w;
+
+            m_invW[i] = inv_w;
+            m_screenX[i] = viewport.x + (ndc_x * 0.5f + 0.5f) * viewport.width;
+            m_screenY[i] = viewport.y + (0.5f - ndc_y * 0.5f) * viewport.height;
+            m_depth[i] = ndc_z * 0.5f + 0.5f;
+
+            // Условия «внутри» с отрицанием: NaN не проходит ни одно сравнение и уходит в Clipper
+            const float limit = band * w;
+            m_needsClipping[i] = static_cast<std::uint8_t>(
+                !(w > 0.0f) |
+                !(cz[i] >= -w) | !(cz[i] <= w) |
+                !(cx[i] >= -limit) | !(cx[i] <= limit) |
+                !(cy[i] >= -limit) | !(cy[i] <= limit)
+            );
+        }
+    }
+}
@@ -3,3 +3,14 @@
 //
 
 #include "../../include/Render/shader.h"
+
+#include "Light/Normal.hpp"
+
+namespace render {
+    std::vector<gmath::Vector3f> triangle_normals(const Mesh& mesh) {
+        // view() — треугольники меша, поэтому грани Normal совпадают с треугольниками
+        gmath::Normal<float> normal(mesh.vertex_count(), mesh.triangle_count());
+        normal.compute_face_normals(mesh.view());
+        return normal.get_face_normals();
+    }
+}
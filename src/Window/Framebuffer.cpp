@@ -6,36 +6,187 @@
 #include "Window/Framebuffer.h"
 #include <algorithm>
 
+#if defined(__x86_64__) || defined(_M_X64)
+    #include <emmintrin.h>
+    #define KGG_FRAMEBUFFER_SSE2 1
+#else
+    #define KGG_FRAMEBUFFER_SSE2 0
+#endif
+
 namespace render {
+    // Заполнение count пикселей одним 32-битным значением
+    static void fill_pixels(std::uint32_t* dst, size_t count, std::uint32_t rgba) {
+        size_t i = 0;
+#if KGG_FRAMEBUFFER_SSE2
+        // Скалярно до границы 16 байт, дальше выровненные векторные записи
+        for (; i < count && (reinterpret_cast<std::uintptr_t>(dst + i) & 15) != 0; ++i) {
+            dst[i] = rgba;
+        }
+        const __m128i pattern = _mm_set1_epi32(static_cast<int>(rgba));
+        for (; i + 16 <= count; i += 16) {
+            _mm_store_si128(reinterpret_cast<__m128i*>(dst + i), pattern);
+            _mm_store_si128(reinterpret_cast<__m128i*>(dst + i + 4), pattern);
+            _mm_store_si128(reinterpret_cast<__m128i*>(dst + i + 8), pattern);
+            _mm_store_si128(reinterpret_cast<__m128i*>(dst + i + 12), pattern);
+        }
+        for (; i + 4 <= count; i += 4) {
+            _mm_store_si128(reinterpret_cast<__m128i*>(dst + i), pattern);
+        }
+#endif
+        for (; i < count; ++i) {
+            dst[i] = rgba;
+        }
+    }
+
     Framebuffer::Framebuffer(uint32_t width, uint32_t height)
-        : m_width(width), m_height(height), m_colorBuffer(width * height * 4)
+        : m_width(width), m_height(height), m_colorBuffer(static_cast<size_t>(width) * height),
+          m_tiles_x((static_cast<int>(width) + TILE_SIZE - 1) / TILE_SIZE),
+          m_tiles_y((static_cast<int>(height) + TILE_SIZE - 1) / TILE_SIZE),
+          m_dirtyTiles(static_cast<size_t>(m_tiles_x) * m_tiles_y, 0),
+          m_depthBuffer(static_cast<size_t>(width) * height, 1.0f),
+          m_blocks_x((static_cast<int>(width) + DEPTH_BLOCK - 1) / DEPTH_BLOCK),
+          m_blocks_y((static_cast<int>(height) + DEPTH_BLOCK - 1) / DEPTH_BLOCK),
+          m_blockMinDepth(static_cast<size_t>(m_blocks_x) * m_blocks_y, 1.0f),
+          m_blockMaxDepth(static_cast<size_t>(m_blocks_x) * m_blocks_y, 1.0f),
+          m_blockStale(static_cast<size_t>(m_blocks_x) * m_blocks_y, 0)
     {}
 
     void Framebuffer::clear(const Color &color) {
-        for (uint32_t y = 0; y < m_height; ++y) {
-            for (uint32_t x = 0; x < m_width; ++x) {
-                set_pixel(x, y, color);
+        const std::uint32_t rgba = color.to_rgba32();
+        if (!m_hasClearColor || rgba != m_clearColor) {
+            clear_full(color);
+            return;
+        }
+
+        for (int ty = 0; ty < m_tiles_y; ++ty) {
+            for (int tx = 0; tx < m_tiles_x; ++tx) {
+                std::uint8_t& dirty = m_dirtyTiles[static_cast<size_t>(ty) * m_tiles_x + tx];
+                if (!dirty) {
+                    continue;
+                }
+                fill_rect({tx * TILE_SIZE, ty * TILE_SIZE, (tx + 1) * TILE_SIZE, (ty + 1) * TILE_SIZE}, rgba);
+                dirty = 0;
             }
         }
     }
 
+    void Framebuffer::clear_full(const Color &color) {
+        m_clearColor = color.to_rgba32();
+        m_hasClearColor = true;
+        fill_pixels(m_colorBuffer.data(), static_cast<size_t>(m_width) * m_height, m_clearColor);
+        std::fill(m_dirtyTiles.begin(), m_dirtyTiles.end(), 0);
+    }
+
+    void Framebuffer::fill_rect(const Rect &rect, std::uint32_t rgba) {
+        const Rect r = rect.intersect({0, 0, static_cast<int>(m_width), static_cast<int>(m_height)});
+        if (r.empty()) {
+            return;
+        }
+        for (int y = r.y0; y < r.y1; ++y) {
+            fill_pixels(get_row(y) + r.x0, static_cast<size_t>(r.width()), rgba);
+        }
+    }
+
     void Framebuffer::set_pixel(int x, int y, const Color &color) {
         if (x < 0 || x >= static_cast<int>(m_width) || y < 0 || y >= static_cast<int>(m_height)) {
             return;
         }
 
-        const size_t index = (y * m_width + x) * 4;
-        m_colorBuffer[index + 0] = color.r;
-        m_colorBuffer[index + 1] = color.g;
-        m_colorBuffer[index + 2] = color.b;
-        m_colorBuffer[index + 3] = color.a;
+        m_dirtyTiles[static_cast<size_t>(y / TILE_SIZE) * m_tiles_x + x / TILE_SIZE] = 1;
+
+        m_colorBuffer[static_cast<size_t>(y) * m_width + x] = color.to_rgba32();
+    }
+
+    void Framebuffer::fill_span(int y, int x0, int x1, std::uint32_t rgba) {
+        if (x1 > x0) {
+            fill_pixels(get_row(static_cast<uint32_t>(y)) + x0, static_cast<size_t>(x1 - x0), rgba);
+        }
+    }
+
+    void Framebuffer::mark_dirty(const Rect &rect) {
+        const Rect r = rect.intersect({0, 0, static_cast<int>(m_width), static_cast<int>(m_height)});
+        if (r.empty()) {
+            return;
+        }
+        for (int ty = r.y0 / TILE_SIZE; ty <= (r.y1 - 1) / TILE_SIZE; ++ty) {
+            for (int tx = r.x0 / TILE_SIZE; tx <= (r.x1 - 1) / TILE_SIZE; ++tx) {
+                m_dirtyTiles[static_cast<size_t>(ty) * m_tiles_x + tx] = 1;
+            }
+        }
+    }
+
+    bool Framebuffer::is_tile_dirty(int tile_x, int tile_y) const {
+        return m_dirtyTiles[static_cast<size_t>(tile_y) * m_tiles_x + tile_x] != 0;
+    }
+
+    int Framebuffer::get_tiles_x() const {
+        return m_tiles_x;
+    }
+
+    int Framebuffer::get_tiles_y() const {
+        return m_tiles_y;
+    }
+
+    bool Framebuffer::has_clear_color() const {
+        return m_hasClearColor;
+    }
+
+    std::uint32_t Framebuffer::get_clear_color() const {
+        return m_clearColor;
+    }
+
+    void Framebuffer::clear_depth(float depth) {
+        std::fill(m_depthBuffer.begin(), m_depthBuffer.end(), depth);
+        std::fill(m_blockMinDepth.begin(), m_blockMinDepth.end(), depth);
+        std::fill(m_blockMaxDepth.begin(), m_blockMaxDepth.end(), depth);
+        std::fill(m_blockStale.begin(), m_blockStale.end(), 0);
+    }
+
+    float Framebuffer::block_max_depth(int block_x, int block_y) {
+        const size_t index = static_cast<size_t>(block_y) * m_blocks_x + block_x;
+        if (m_blockStale[index]) {
+            const int x0 = block_x * DEPTH_BLOCK;
+            const int y0 = block_y * DEPTH_BLOCK;
+            const int x1 = std::min(x0 + DEPTH_BLOCK, static_cast<int>(m_width));
+            const int y1 = std::min(y0 + DEPTH_BLOCK, static_cast<int>(m_height));
+
+            float max_depth = get_depth_row(y0)[x0];
+            for (int y = y0; y < y1; ++y) {
+                const float* row = get_depth_row(y);
+                for (int x = x0; x < x1; ++x) {
+                    max_depth = std::max(max_depth, row[x]);
+                }
+            }
+            m_blockMaxDepth[index] = max_depth;
+            m_blockStale[index] = 0;
+        }
+        return m_blockMaxDepth[index];
+    }
+
+    float Framebuffer::block_min_depth(int block_x, int block_y) const {
+        return m_blockMinDepth[static_cast<size_t>(block_y) * m_blocks_x + block_x];
+    }
+
+    void Framebuffer::note_depth_write(int block_x, int block_y, float min_depth) {
+        // Записи только уменьшают глубину: старый максимум остаётся верной (грубой) границей
+        const size_t index = static_cast<size_t>(block_y) * m_blocks_x + block_x;
+        m_blockMinDepth[index] = std::min(m_blockMinDepth[index], min_depth);
+        m_blockStale[index] = 1;
     }
 
     // Получаем указатель на массив данных
     const uint8_t* Framebuffer::get_data() const {
+        return reinterpret_cast<const uint8_t*>(m_colorBuffer.data());
+    }
+
+    const std::uint32_t* Framebuffer::get_pixels() const {
         return m_colorBuffer.data();
     }
 
+    size_t Framebuffer::get_stride() const {
+        return m_width;
+    }
+
     uint32_t Framebuffer::get_width() const {
         return m_width;
     }
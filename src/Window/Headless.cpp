@@ -0,0 +1,297 @@
+//
+// Created by shulz on 18.12.2025.
+//
+
+#include "Window/Headless.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <numbers>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+#include "Profile/Profiler.h"
+#include "ReadWrite/ImageWriter.h"
+#include "Render/Clipper.h"
+#include "Render/Mesh.h"
+#include "Render/ShaderPipeline.h"
+#include "Render/ThreadPool.h"
+#include "Render/VertexStage.h"
+#include "Render/shader.h"
+#include "Scene/Camera.h"
+#include "Window/Framebuffer.h"
+
+namespace {
+    using Clock = std::chrono::steady_clock;
+
+    template<class T>
+    T parse_number(std::string_view name, const std::string& value) {
+        try {
+            std::size_t used = 0;
+            T result;
+            if constexpr (std::is_floating_point_v<T>) {
+                result = static_cast<T>(std::stod(value, &used));
+            } else {
+                const long long parsed = std::stoll(value, &used);
+                if (parsed < 0 || parsed > static_cast<long long>(std::numeric_limits<T>::max())) {
+                    throw std::out_of_range("");
+                }
+                result = static_cast<T>(parsed);
+            }
+            if (used != value.size()) {
+                throw std::invalid_argument("");
+            }
+            return result;
+        } catch (const std::logic_error&) {
+            throw std::invalid_argument("Invalid value for " + std::string(name) + ": " + value);
+        }
+    }
+
+    // Камера на окружности вокруг модели, на расстоянии, при котором видна вся сфера bounds
+    struct Orbit {
+        gmath::Vector3f center;
+        float distance;
+        float height;
+
+        static Orbit around(const Mesh& mesh, float fov_y) {
+            constexpr float MAX = std::numeric_limits<float>::max();
+            gmath::Vector3f low(MAX, MAX, MAX);
+            gmath::Vector3f high(-MAX, -MAX, -MAX);
+            for (std::uint32_t i = 0; i < mesh.vertex_count(); ++i) {
+                const gmath::Vector3f p = mesh.position(i);
+                low = {std::min(low.x, p.x), std::min(low.y, p.y), std::min(low.z, p.z)};
+                high = {std::max(high.x, p.x), std::max(high.y, p.y), std::max(high.z, p.z)};
+            }
+            const float radius = std::max((high - low).length() * 0.5f, 1e-3f);
+            const float distance = radius / std::sin(fov_y * 0.5f) * 1.1f;
+            return {(low + high) * 0.5f, distance, distance * 0.35f};
+        }
+
+        [[nodiscard]] gmath::Vector3f eye(float angle) const {
+            return center + gmath::Vector3f(std::sin(angle) * distance, height, std::cos(angle) * distance);
+        }
+    };
+
+    struct Stats {
+        double render_ms = 0.0;
+        double output_ms = 0.0;
+        profile::FrameStats profile; // сумма по кадрам, если включён Profiler
+    };
+
+    template<render::Shader S>
+    Stats render_frames(const HeadlessOptions& options, const Mesh& mesh, S shader) {
+        render::ThreadPool pool(options.threads == 0 ? render::ThreadPool::default_worker_count() : options.threads);
+        render::VertexStage stage(pool);
+        render::ShaderPipeline<S> pipeline(pool);
+        render::Framebuffer fb(options.width, options.height);
+        const render::Clipper clipper({0.0f, 0.0f, static_cast<float>(options.width), static_cast<float>(options.height)});
+
+        Camera camera;
+        camera.aspect = static_cast<float>(options.width) / static_cast<float>(options.height);
+        const Orbit orbit = Orbit::around(mesh, camera.fov_y);
+        camera.target = orbit.center;
+        camera.z_near = orbit.distance * 0.01f;
+        camera.z_far = orbit.distance * 4.0f;
+
+        // Все кадры — в один поток: файл .raw или stdout
+        std::unique_ptr<std::ofstream> stream_file;
+        std::ostream* stream = nullptr;
+        const bool to_stream = !options.output.empty() &&
+                               io::format_for_path(options.output) == io::ImageFormat::raw;
+        if (to_stream && options.output == "-") {
+            stream = &std::cout;
+        } else if (to_stream) {
+            stream_file = std::make_unique<std::ofstream>(options.output, std::ios::binary | std::ios::trunc);
+            stream = stream_file.get();
+        }
+
+        Stats stats;
+        for (int frame = 0; frame < options.frames; ++frame) {
+            const float angle = options.spin * static_cast<float>(frame) * std::numbers::pi_v<float> / 180.0f;
+            camera.eye = orbit.eye(angle);
+            // Свет от камеры
+            shader.light.eye = camera.eye;
+            shader.light.direction = (camera.eye - orbit.center).normalized();
+
+            const auto start = Clock::now();
+            {
+                KGG_PROFILE_SCOPE(frame);
+                {
+                    KGG_PROFILE_SCOPE(clear);
+                    fb.clear(render::Color::black());
+                    fb.clear_depth();
+                }
+                pipeline.draw(mesh, shader, camera.view_projection(), clipper, stage, fb);
+            }
+            const auto rendered = Clock::now();
+            stats.render_ms += std::chrono::duration<double, std::milli>(rendered - start).count();
+
+            if (stream) {
+                io::write_raw(*stream, fb);
+                if (!*stream) {
+                    throw std::runtime_error("Cannot write frame stream: " + options.output);
+                }
+            } else if (!options.output.empty()) {
+                io::write_image(options.frame_path(frame), fb);
+            }
+            stats.output_ms += std::chrono::duration<double, std::milli>(Clock::now() - rendered).count();
+
+            if (profile::Profiler::instance().enabled()) {
+                const profile::FrameStats frame_stats = profile::Profiler::instance().collect();
+                for (std::size_t i = 0; i < profile::STAGE_COUNT; ++i) {
+                    stats.profile.stage_ms[i] += frame_stats.stage_ms[i];
+                }
+                for (std::size_t i = 0; i < profile::COUNTER_COUNT; ++i) {
+                    stats.profile.counters[i] += frame_stats.counters[i];
+                }
+            }
+        }
+        if (stream) {
+            stream->flush();
+        }
+        return stats;
+    }
+}
+
+bool HeadlessOptions::requested(int argc, const char* const* argv) {
+    for (int i = 1; i < argc; ++i) {
+        if (std::string_view(argv[i]) == "--headless") {
+            return true;
+        }
+    }
+    return false;
+}
+
+HeadlessOptions HeadlessOptions::parse(int argc, const char* const* argv) {
+    HeadlessOptions options;
+    for (int i = 1; i < argc; ++i) {
+        const std::string_view arg = argv[i];
+        if (arg == "--headless") {
+            continue;
+        }
+        if (i + 1 >= argc) {
+            throw std::invalid_argument("Missing value for " + std::string(arg));
+        }
+        const std::string value = argv[++i];
+
+        if (arg == "--model") {
+            options.model = value;
+        } else if (arg == "--shader") {
+            if (value != "flat" && value != "gouraud" && value != "phong") {
+                throw std::invalid_argument("Unknown shader: " + value);
+            }
+            options.shader = value;
+        } else if (arg == "--size") {
+            const std::size_t x = value.find('x');
+            if (x == std::string::npos) {
+                throw std::invalid_argument("Invalid value for --size: " + value);
+            }
+            options.width = parse_number<std::uint32_t>(arg, value.substr(0, x));
+            options.height = parse_number<std::uint32_t>(arg, value.substr(x + 1));
+        } else if (arg == "--frames") {
+            options.frames = parse_number<int>(arg, value);
+        } else if (arg == "--spin") {
+            options.spin = parse_number<float>(arg, value);
+        } else if (arg == "--threads") {
+            options.threads = parse_number<std::size_t>(arg, value);
+        } else if (arg == "--output") {
+            options.output = value;
+        } else if (arg == "--profile") {
+            options.profile = value;
+        } else {
+            throw std::invalid_argument("Unknown argument: " + std::string(arg));
+        }
+    }
+
+    if (options.model.empty()) {
+        throw std::invalid_argument("--model is required");
+    }
+    if (options.width == 0 || options.height == 0 || options.frames <= 0) {
+        throw std::invalid_argument("--size and --frames must be positive");
+    }
+    return options;
+}
+
+std::string HeadlessOptions::frame_path(int frame) const {
+    const std::size_t first = output.find('#');
+    if (first == std::string::npos) {
+        if (frames == 1) {
+            return output;
+        }
+        std::string number = std::to_string(frame);
+        number.insert(0, number.size() < 4 ? 4 - number.size() : 0, '0');
+        const std::size_t dot = output.rfind('.');
+        const std::size_t slash = output.find_last_of("/\\");
+        const std::size_t at = dot == std::string::npos || (slash != std::string::npos && dot < slash) ? output.size() : dot;
+        return output.substr(0, at) + "_" + number + output.substr(at);
+    }
+
+    const std::size_t last = output.find_first_not_of('#', first);
+    const std::size_t width = (last == std::string::npos ? output.size() : last) - first;
+    std::string number = std::to_string(frame);
+    number.insert(0, number.size() < width ? width - number.size() : 0, '0');
+    return output.substr(0, first) + number + output.substr(first + width);
+}
+
+int Headless::run(const HeadlessOptions& options) {
+    const Mesh mesh = Mesh::load(options.model);
+
+    render::Light light;
+    light.specular = 0.35f;
+    const render::Color color(200, 200, 200, 255);
+
+    profile::Profiler& profiler = profile::Profiler::instance();
+    if (!options.profile.empty()) {
+        profiler.set_enabled(true);
+        profiler.start_capture();
+    }
+
+    Stats stats;
+    std::vector<gmath::Vector3f> face_normals;
+    if (options.shader == "flat") {
+        face_normals = render::triangle_normals(mesh);
+        stats = render_frames(options, mesh, render::FlatShader{color, light, face_normals});
+    } else if (options.shader == "gouraud") {
+        stats = render_frames(options, mesh, render::GouraudShader{color, light});
+    } else {
+        stats = render_frames(options, mesh, render::PhongShader{color, light});
+    }
+
+    const double per_frame = stats.render_ms / options.frames;
+    std::cerr << "frames: " << options.frames
+              << ", triangles: " << mesh.triangle_count()
+              << ", size: " << options.width << 'x' << options.height << '\n'
+              << "render: " << stats.render_ms << " ms (" << per_frame << " ms/frame, "
+              << (per_frame > 0.0 ? 1000.0 / per_frame : 0.0) << " fps)\n"
+              << "output: " << stats.output_ms << " ms\n";
+
+    if (!options.profile.empty()) {
+        profiler.stop_capture();
+        profiler.set_enabled(false);
+        profiler.write_chrome_trace(options.profile);
+
+        // tile — сумма по потокам пула, остальные этапы — время на своём потоке
+        std::cerr << "profile (" << options.profile << ", " << profiler.captured_events() << " events";
+        if (profiler.dropped_events() > 0) {
+            std::cerr << ", " << profiler.dropped_events() << " dropped";
+        }
+        std::cerr << "):\n";
+        for (std::size_t i = 0; i < profile::STAGE_COUNT; ++i) {
+            std::cerr << "  " << profile::name(static_cast<profile::Stage>(i)) << ": "
+                      << stats.profile.stage_ms[i] << " ms\n";
+        }
+        for (std::size_t i = 0; i < profile::COUNTER_COUNT; ++i) {
+            std::cerr << "  " << profile::name(static_cast<profile::Counter>(i)) << ": "
+                      << stats.profile.counters[i] << '\n';
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,166 @@
+//
+// Created by shulz on 18.12.2025.
+//
+
+#include "Window/Presenter.h"
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace render {
+    Presenter::Presenter(uint32_t width, uint32_t height, std::size_t buffer_count)
+        : m_width(width), m_height(height)
+    {
+        if (buffer_count < 2) {
+            throw std::invalid_argument("Presenter needs at least two buffers");
+        }
+        m_buffers.reserve(buffer_count);
+        for (std::size_t i = 0; i < buffer_count; ++i) {
+            m_buffers.emplace_back(width, height);
+        }
+        m_states.assign(buffer_count, State::free);
+    }
+
+    Framebuffer& Presenter::acquire() {
+        std::unique_lock lock(m_mutex);
+        std::size_t index = NONE;
+        m_freed.wait(lock, [&] {
+            const auto it = std::find(m_states.begin(), m_states.end(), State::free);
+            index = static_cast<std::size_t>(it - m_states.begin());
+            return it != m_states.end();
+        });
+        m_states[index] = State::rendering;
+        return m_buffers[index];
+    }
+
+    void Presenter::submit(Framebuffer& frame) {
+        const std::size_t index = index_of(frame);
+        {
+            std::lock_guard lock(m_mutex);
+            if (m_ready != NONE) {
+                m_states[m_ready] = State::free;
+            }
+            m_ready = index;
+            m_states[index] = State::ready;
+        }
+        m_freed.notify_all();
+    }
+
+    bool Presenter::present(const Upload& upload) {
+        std::size_t index;
+        {
+            std::lock_guard lock(m_mutex);
+            if (m_ready == NONE) {
+                return false;
+            }
+            index = m_ready;
+            m_ready = NONE;
+            m_states[index] = State::presenting;
+        }
+
+        // Буфер в состоянии presenting рендер не трогает — читаем без блокировки
+        const Framebuffer& frame = m_buffers[index];
+        collect_rects(frame);
+
+        m_lastUploadPixels = 0;
+        for (const Rect& rect : m_rects) {
+            upload(frame, rect);
+            m_lastUploadPixels += static_cast<std::size_t>(rect.width()) * rect.height();
+        }
+
+        const std::size_t tiles = static_cast<std::size_t>(frame.get_tiles_x()) * frame.get_tiles_y();
+        m_shownTiles.resize(tiles);
+        for (int ty = 0; ty < frame.get_tiles_y(); ++ty) {
+            for (int tx = 0; tx < frame.get_tiles_x(); ++tx) {
+                m_shownTiles[static_cast<std::size_t>(ty) * frame.get_tiles_x() + tx] = frame.is_tile_dirty(tx, ty);
+            }
+        }
+        m_hasShown = frame.has_clear_color();
+        m_shownClearColor = frame.get_clear_color();
+
+        {
+            std::lock_guard lock(m_mutex);
+            m_states[index] = State::free;
+        }
+        m_freed.notify_all();
+        return true;
+    }
+
+    void Presenter::collect_rects(const Framebuffer& frame) {
+        const int tiles_x = frame.get_tiles_x();
+        const int tiles_y = frame.get_tiles_y();
+        const Rect bounds{0, 0, static_cast<int>(m_width), static_cast<int>(m_height)};
+
+        m_rects.clear();
+        const bool full = !m_hasShown || !frame.has_clear_color() || frame.get_clear_color() != m_shownClearColor;
+        if (full) {
+            m_rects.push_back(bounds);
+            return;
+        }
+
+        // Тайлы, отмеченные в новом или в показанном кадре
+        m_uploadTiles.assign(static_cast<std::size_t>(tiles_x) * tiles_y, 0);
+        for (int ty = 0; ty < tiles_y; ++ty) {
+            for (int tx = 0; tx < tiles_x; ++tx) {
+                const std::size_t i = static_cast<std::size_t>(ty) * tiles_x + tx;
+                m_uploadTiles[i] = frame.is_tile_dirty(tx, ty) || m_shownTiles[i];
+            }
+        }
+
+        // Отрезки подряд идущих тайлов в строке; отрезок с теми же границами,
+        // что у прямоугольника из предыдущей строки, продлевает его вниз
+        constexpr int T = Framebuffer::TILE_SIZE;
+        for (int ty = 0; ty < tiles_y; ++ty) {
+            const std::size_t current_row = m_rects.size();
+            for (int tx = 0; tx < tiles_x;) {
+                if (!m_uploadTiles[static_cast<std::size_t>(ty) * tiles_x + tx]) {
+                    ++tx;
+                    continue;
+                }
+                const int begin = tx;
+                while (tx < tiles_x && m_uploadTiles[static_cast<std::size_t>(ty) * tiles_x + tx]) {
+                    ++tx;
+                }
+                const Rect run = Rect{begin * T, ty * T, tx * T, (ty + 1) * T}.intersect(bounds);
+
+                bool merged = false;
+                for (std::size_t k = 0; k < current_row; ++k) {
+                    Rect& above = m_rects[k];
+                    if (above.x0 == run.x0 && above.x1 == run.x1 && above.y1 == run.y0) {
+                        above.y1 = run.y1;
+                        merged = true;
+                        break;
+                    }
+                }
+                if (!merged) {
+                    m_rects.push_back(run);
+                }
+            }
+        }
+    }
+
+    std::size_t Presenter::index_of(const Framebuffer& frame) const {
+        for (std::size_t i = 0; i < m_buffers.size(); ++i) {
+            if (&m_buffers[i] == &frame) {
+                return i;
+            }
+        }
+        throw std::invalid_argument("Framebuffer does not belong to this Presenter");
+    }
+
+    std::size_t Presenter::last_upload_pixels() const {
+        return m_lastUploadPixels;
+    }
+
+    std::size_t Presenter::buffer_count() const {
+        return m_buffers.size();
+    }
+
+    uint32_t Presenter::get_width() const {
+        return m_width;
+    }
+
+    uint32_t Presenter::get_height() const {
+        return m_height;
+    }
+}
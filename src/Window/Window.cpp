@@ -1,4 +1,8 @@
+#include <cfloat>
+#include <cmath>
+#include <cstdio>
 #include <iostream>
+#include <vector>
 #include "Window/Window.hpp"
 #include <GLFW/glfw3.h>
 #include <SFML/Graphics.hpp>
@@ -6,27 +10,160 @@
 #include "imgui_impl_opengl3.h"
 #include "imgui-SFML.h"
 #include "imgui.h"
+#include "Profile/Profiler.h"
 #include "Render/Rasterizer.h"
+#include "Render/ThreadPool.h"
+#include "Render/TiledRenderer.h"
 #include "Window/Framebuffer.h"
+#include "Window/Presenter.h"
+#include "Window/RenderThread.h"
 constexpr uint32_t WIDTH = 800;
 constexpr uint32_t HEIGHT = 600;
 
+namespace {
+    // Всё, что нужно рендеру для кадра; UI собирает снимок и отдаёт его потоку рендера
+    struct SceneSnapshot {
+        float angle = 0.0f; // поворот треугольников вокруг центра окна, радианы
+    };
+
+    gmath::Vector2f rotate(const gmath::Vector2f& p, float angle) {
+        const gmath::Vector2f center(WIDTH * 0.5f, HEIGHT * 0.5f);
+        const float c = std::cos(angle);
+        const float s = std::sin(angle);
+        const gmath::Vector2f d = p - center;
+        return {center.x + d.x * c - d.y * s, center.y + d.x * s + d.y * c};
+    }
+
+    void render_scene(const SceneSnapshot& scene, render::Framebuffer& fb, render::TiledRenderer& renderer) {
+        KGG_PROFILE_SCOPE(frame);
+        {
+            KGG_PROFILE_SCOPE(clear);
+            fb.clear(render::Color::black());
+        }
+
+        {
+            KGG_PROFILE_SCOPE(binning);
+            renderer.begin_frame(fb);
+            renderer.draw_colored_triangle(
+                rotate({200.f, 100.f}, scene.angle),
+                rotate({600.f, 150.f}, scene.angle),
+                rotate({400.f, 500.f}, scene.angle),
+                render::Color::red(),
+                render::Color::blue(),
+                render::Color::green()
+                );
+            renderer.draw_colored_triangle(
+                rotate({250.f, 100.f}, scene.angle),
+                rotate({670.f, 250.f}, scene.angle),
+                rotate({100.f, 1000.f}, scene.angle),
+                render::Color::red(),
+                render::Color::blue(),
+                render::Color::green()
+                );
+        }
+        renderer.end_frame();
+    }
+
+    // Графики этапов и счётчики за последний кадр; запись трассы для chrome://tracing / Perfetto
+    void draw_profiler(profile::Profiler& profiler, std::vector<float>& values) {
+        ImGui::Begin("Profiler");
+        bool enabled = profiler.enabled();
+        if (ImGui::Checkbox("Enabled", &enabled)) {
+            profiler.set_enabled(enabled);
+        }
+
+        const profile::FrameStats& last = profiler.last();
+        for (std::size_t i = 0; i < profile::STAGE_COUNT; ++i) {
+            const auto stage = static_cast<profile::Stage>(i);
+            profiler.stage_history(stage, values);
+            char overlay[32];
+            std::snprintf(overlay, sizeof(overlay), "%.3f ms", last.stage_ms[i]);
+            ImGui::PlotLines(
+                profile::name(stage), values.data(), static_cast<int>(values.size()),
+                0, overlay, 0.0f, FLT_MAX, ImVec2(0.0f, 40.0f)
+                );
+        }
+
+        profiler.counter_history(profile::Counter::pixels_shaded, values);
+        ImGui::PlotHistogram(
+            "pixels_shaded", values.data(), static_cast<int>(values.size()),
+            0, nullptr, 0.0f, FLT_MAX, ImVec2(0.0f, 40.0f)
+            );
+        for (std::size_t i = 0; i < profile::COUNTER_COUNT; ++i) {
+            ImGui::Text("%s: %llu", profile::name(static_cast<profile::Counter>(i)),
+                        static_cast<unsigned long long>(last.counters[i]));
+        }
+        ImGui::Text("Dropped events: %llu", static_cast<unsigned long long>(profiler.dropped_events()));
+
+        if (!profiler.capturing()) {
+            if (ImGui::Button("Start capture")) {
+                profiler.start_capture();
+            }
+        } else {
+            if (ImGui::Button("Stop capture")) {
+                profiler.stop_capture();
+            }
+            ImGui::SameLine();
+            ImGui::Text("%zu events", profiler.captured_events());
+        }
+        if (!profiler.capturing() && profiler.captured_events() > 0) {
+            ImGui::SameLine();
+            if (ImGui::Button("Save trace.json")) {
+                try {
+                    profiler.write_chrome_trace("trace.json");
+                } catch (const std::exception& e) {
+                    std::cerr << e.what() << '\n';
+                }
+            }
+        }
+        ImGui::End();
+    }
+}
+
 void Window::create_Window() {
     sf::RenderWindow window(
      sf::VideoMode({WIDTH, HEIGHT}),
      "SFML + ImGui"
  );
-    render::Framebuffer fb(WIDTH, HEIGHT);
+    render::Presenter presenter(WIDTH, HEIGHT);
+    render::ThreadPool pool;
+    render::TiledRenderer renderer(pool);
     sf::Texture texture(sf::Vector2u(WIDTH, HEIGHT));
 
     sf::Sprite sprite(texture);
 
+    // Загрузка прямо из памяти кадра, без промежуточной копии: UNPACK_ROW_LENGTH
+    // задаёт шаг строк буфера, и glTexSubImage2D читает только прямоугольник rect
+    const render::Presenter::Upload upload = [&texture](const render::Framebuffer& frame, const render::Rect& rect) {
+        sf::Texture::bind(&texture);
+        glPixelStorei(GL_UNPACK_ROW_LENGTH, static_cast<GLint>(frame.get_stride()));
+        glTexSubImage2D(
+            GL_TEXTURE_2D, 0,
+            rect.x0, rect.y0, rect.width(), rect.height(),
+            GL_RGBA, GL_UNSIGNED_BYTE,
+            frame.get_row(static_cast<uint32_t>(rect.y0)) + rect.x0
+            );
+        glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
+        sf::Texture::bind(nullptr);
+    };
 
     window.setFramerateLimit(60);
 
     ImGui::SFML::Init(window);
 
+    profile::Profiler& profiler = profile::Profiler::instance();
+    profiler.set_enabled(true);
+    std::vector<float> plot_values;
+
     sf::Clock deltaClock;
+    SceneSnapshot scene;
+    float speed = 0.5f;
+    // Рендер не держит UI: медленный кадр не тормозит ввод, медленный UI — рендер
+    render::RenderThread<SceneSnapshot> render_thread(
+        presenter,
+        [&renderer](const SceneSnapshot& snapshot, render::Framebuffer& fb) {
+            render_scene(snapshot, fb, renderer);
+        });
 
     while (window.isOpen())
     {
@@ -37,34 +174,28 @@ void Window::create_Window() {
             if (event->is<sf::Event::Closed>())
                 window.close();
         }
-        fb.clear(render::Color::black());
-
-        render::Rasterizer::draw_colored_triangle(
-            fb,
-            {200.f, 100.f},
-            {600.f, 150.f},
-            {400.f, 500.f},
-            render::Color::red(),
-            render::Color::blue(),
-            render::Color::green()
-            );
-        render::Rasterizer::draw_colored_triangle(
-            fb,
-            {250.f, 100.f},
-            {670.f, 250.f},
-            {100.f, 1000.f},
-            render::Color::red(),
-            render::Color::blue(),
-            render::Color::green()
-            );
-        ImGui::SFML::Update(window, deltaClock.restart());
-        texture.update(fb.get_data());
+        const sf::Time delta = deltaClock.restart();
+        scene.angle += speed * delta.asSeconds();
+        render_thread.push(scene);
+        {
+            KGG_PROFILE_SCOPE(upload);
+            presenter.present(upload);
+        }
+        // Всё, что потоки записали с прошлого кадра UI
+        profiler.collect();
+
+        ImGui::SFML::Update(window, delta);
         window.clear(sf::Color(100, 0, 0));
         window.draw(sprite);
         ImGui::Begin("Hello");
         ImGui::Text("SFML 3 + ImGui works");
+        ImGui::SliderFloat("Speed", &speed, 0.0f, 3.0f);
+        ImGui::Text("Render: %.2f ms", render_thread.last_frame_ms());
+        ImGui::Text("Dropped snapshots: %zu", render_thread.snapshots_dropped());
+        ImGui::Text("Uploaded: %zu px", presenter.last_upload_pixels());
         ImGui::Image(texture);
         ImGui::End();
+        draw_profiler(profiler, plot_values);
         ImGui::SFML::Render(window);
         window.display();
     }
@@ -2,8 +2,20 @@
 // Created by akemi on 09.12.25.
 //
 
+#include <exception>
+#include <iostream>
+
+#include "Window/Headless.h"
 #include "Window/Window.hpp"
 
-int main() {
+int main(int argc, char** argv) {
+    if (HeadlessOptions::requested(argc, argv)) {
+        try {
+            return Headless::run(HeadlessOptions::parse(argc, argv));
+        } catch (const std::exception& error) {
+            std::cerr << error.what() << '\n';
+            return 1;
+        }
+    }
     Window::create_Window();
 }
@@ -0,0 +1,289 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
+#include <thread>
+
+#include <Render/Rasterizer.h>
+#include <Window/Framebuffer.h>
+#include <Window/Presenter.h>
+#include <Window/RenderThread.h>
+
+using namespace render;
+
+namespace {
+    bool all_pixels_are(const Framebuffer& fb, const Color& color) {
+        const uint8_t* data = fb.get_data();
+        for (size_t i = 0; i < size_t(fb.get_width()) * fb.get_height(); ++i) {
+            if (data[i * 4] != color.r || data[i * 4 + 1] != color.g ||
+                data[i * 4 + 2] != color.b || data[i * 4 + 3] != color.a) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // Имитация текстуры: применяет прямоугольники из Presenter::present
+    struct FakeTexture {
+        uint32_t width, height;
+        std::vector<uint32_t> pixels;
+
+        FakeTexture(uint32_t w, uint32_t h) : width(w), height(h), pixels(size_t(w) * h, 0) {}
+
+        Presenter::Upload upload() {
+            return [this](const Framebuffer& frame, const Rect& rect) {
+                for (int y = rect.y0; y < rect.y1; ++y) {
+                    const uint32_t* src = frame.get_row(static_cast<uint32_t>(y));
+                    std::copy(src + rect.x0, src + rect.x1, pixels.begin() + size_t(y) * width + rect.x0);
+                }
+            };
+        }
+
+        bool matches(const Framebuffer& frame) const {
+            for (uint32_t y = 0; y < height; ++y) {
+                if (!std::equal(frame.get_row(y), frame.get_row(y) + width, pixels.begin() + size_t(y) * width)) {
+                    return false;
+                }
+            }
+            return true;
+        }
+    };
+
+    void draw_small_triangle(Framebuffer& fb, float x) {
+        Rasterizer::draw_triangle(fb, {x, 10.f}, {x + 30.f, 12.f}, {x + 5.f, 40.f}, Color::white());
+    }
+}
+
+// ========================================================
+// 1. Clear
+// ========================================================
+
+TEST(FramebufferTests, ClearFillsEveryPixel) {
+    // Ширина не кратна ни 4, ни тайлу
+    Framebuffer fb(131, 67);
+    fb.clear(Color(1, 2, 3, 4));
+    EXPECT_TRUE(all_pixels_are(fb, Color(1, 2, 3, 4)));
+}
+
+TEST(FramebufferTests, LazyClearRestoresDirtyTilesOnly) {
+    Framebuffer fb(200, 150);
+    fb.clear(Color::black());
+    EXPECT_FALSE(fb.is_tile_dirty(0, 0));
+
+    Rasterizer::draw_triangle(fb, {10.f, 10.f}, {190.f, 20.f}, {30.f, 140.f}, Color::white());
+    fb.set_pixel(199, 149, Color::red());
+    EXPECT_TRUE(fb.is_tile_dirty(0, 0));
+    EXPECT_TRUE(fb.is_tile_dirty(3, 2));
+
+    fb.clear(Color::black());
+    EXPECT_TRUE(all_pixels_are(fb, Color::black()));
+    EXPECT_FALSE(fb.is_tile_dirty(0, 0));
+    EXPECT_FALSE(fb.is_tile_dirty(3, 2));
+}
+
+TEST(FramebufferTests, ClearWithNewColorRewritesEverything) {
+    Framebuffer fb(100, 100);
+    fb.clear(Color::black());
+    fb.clear(Color::blue());
+    EXPECT_TRUE(all_pixels_are(fb, Color::blue()));
+}
+
+// ========================================================
+// 2. Packed storage and unchecked writes
+// ========================================================
+
+TEST(FramebufferTests, PixelsArePackedAndAligned) {
+    Framebuffer fb(33, 7);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(fb.get_pixels()) % 64, 0u);
+    EXPECT_EQ(fb.get_row(3), fb.get_pixels() + 3 * fb.get_stride());
+
+    fb.set_pixel(5, 2, Color(10, 20, 30, 40));
+    const uint8_t* bytes = fb.get_data() + (2 * fb.get_stride() + 5) * 4;
+    EXPECT_EQ(bytes[0], 10);
+    EXPECT_EQ(bytes[1], 20);
+    EXPECT_EQ(bytes[2], 30);
+    EXPECT_EQ(bytes[3], 40);
+}
+
+TEST(FramebufferTests, FillSpanWritesHalfOpenRange) {
+    Framebuffer fb(40, 4);
+    fb.clear(Color::black());
+    fb.fill_span(1, 3, 37, Color::red().to_rgba32());
+
+    const uint32_t* row = fb.get_row(1);
+    EXPECT_EQ(row[2], Color::black().to_rgba32());
+    EXPECT_EQ(row[3], Color::red().to_rgba32());
+    EXPECT_EQ(row[36], Color::red().to_rgba32());
+    EXPECT_EQ(row[37], Color::black().to_rgba32());
+    EXPECT_EQ(fb.get_row(0)[10], Color::black().to_rgba32());
+}
+
+// ========================================================
+// 3. Presenter
+// ========================================================
+
+TEST(FramebufferTests, PresenterUploadsOnlyChangedTiles) {
+    Presenter presenter(300, 200);
+    FakeTexture texture(300, 200);
+    const size_t full = 300 * 200;
+
+    EXPECT_FALSE(presenter.present(texture.upload()));
+
+    // Первый кадр — целиком
+    Framebuffer& first = presenter.acquire();
+    first.clear(Color::black());
+    draw_small_triangle(first, 10.f);
+    presenter.submit(first);
+    ASSERT_TRUE(presenter.present(texture.upload()));
+    EXPECT_EQ(presenter.last_upload_pixels(), full);
+    EXPECT_TRUE(texture.matches(first));
+
+    // Треугольник сдвинулся: старый тайл (стереть) и новый (нарисовать)
+    Framebuffer& second = presenter.acquire();
+    second.clear(Color::black());
+    draw_small_triangle(second, 140.f);
+    presenter.submit(second);
+    ASSERT_TRUE(presenter.present(texture.upload()));
+    EXPECT_EQ(presenter.last_upload_pixels(), size_t(2 * Framebuffer::TILE_SIZE * Framebuffer::TILE_SIZE));
+    EXPECT_TRUE(texture.matches(second));
+
+    // Новый цвет очистки меняет каждый пиксель
+    Framebuffer& third = presenter.acquire();
+    third.clear(Color::blue());
+    presenter.submit(third);
+    ASSERT_TRUE(presenter.present(texture.upload()));
+    EXPECT_EQ(presenter.last_upload_pixels(), full);
+    EXPECT_TRUE(texture.matches(third));
+}
+
+TEST(FramebufferTests, PresenterShowsLatestSubmittedFrame) {
+    Presenter presenter(64, 64, 3);
+    FakeTexture texture(64, 64);
+
+    // С тремя буферами рендер не ждёт показа: непоказанный кадр отбрасывается
+    Framebuffer* last = nullptr;
+    for (int i = 0; i < 5; ++i) {
+        Framebuffer& fb = presenter.acquire();
+        fb.clear(Color(static_cast<uint8_t>(i), 0, 0, 255));
+        presenter.submit(fb);
+        last = &fb;
+    }
+    ASSERT_TRUE(presenter.present(texture.upload()));
+    EXPECT_TRUE(texture.matches(*last));
+    EXPECT_EQ(texture.pixels[0], Color(4, 0, 0, 255).to_rgba32());
+    EXPECT_FALSE(presenter.present(texture.upload()));
+
+    EXPECT_THROW(Presenter(64, 64, 1), std::invalid_argument);
+}
+
+TEST(FramebufferTests, PresenterKeepsTextureInSyncAcrossThreads) {
+    Presenter presenter(200, 150, 2);
+    FakeTexture texture(200, 150);
+    constexpr int FRAMES = 200;
+    std::atomic<bool> done = false;
+
+    std::thread producer([&] {
+        for (int i = 0; i < FRAMES; ++i) {
+            Framebuffer& fb = presenter.acquire();
+            fb.clear(i % 50 == 0 ? Color::blue() : Color::black());
+            draw_small_triangle(fb, static_cast<float>(i % 160));
+            presenter.submit(fb);
+        }
+        done = true;
+    });
+
+    // Копия показанного кадра: буфер после present снова достаётся рендеру
+    Framebuffer shown(200, 150);
+    int presented = 0;
+    auto upload = texture.upload();
+    auto present = [&] {
+        return presenter.present([&](const Framebuffer& frame, const Rect& rect) {
+            upload(frame, rect);
+            for (uint32_t y = 0; y < 150; ++y) {
+                std::copy(frame.get_row(y), frame.get_row(y) + 200, shown.get_row(y));
+            }
+        });
+    };
+    bool in_sync = true;
+    while (!done) {
+        if (present()) {
+            ++presented;
+            in_sync = in_sync && texture.matches(shown);
+        }
+    }
+    producer.join();
+    if (present()) {
+        ++presented;
+        in_sync = in_sync && texture.matches(shown);
+    }
+
+    EXPECT_GT(presented, 0);
+    EXPECT_TRUE(in_sync);
+}
+
+// ========================================================
+// 4. Поток рендера
+// ========================================================
+
+TEST(FramebufferTests, RenderThreadRendersSnapshotsInOrder) {
+    Presenter presenter(64, 64);
+    std::vector<int> rendered;
+    {
+        RenderThread<int> thread(presenter, [&](const int& value, Framebuffer& fb) {
+            fb.clear(Color(static_cast<uint8_t>(value), 0, 0, 255));
+            rendered.push_back(value);
+        }, 8);
+        for (int i = 1; i <= 5; ++i) {
+            EXPECT_TRUE(thread.push(i));
+        }
+        thread.wait_idle();
+        EXPECT_EQ(thread.frames_rendered(), 5u);
+        EXPECT_EQ(thread.snapshots_dropped(), 0u);
+    }
+    EXPECT_EQ(rendered, (std::vector<int>{1, 2, 3, 4, 5}));
+
+    FakeTexture texture(64, 64);
+    ASSERT_TRUE(presenter.present(texture.upload()));
+    EXPECT_EQ(texture.pixels[0], Color(5, 0, 0, 255).to_rgba32());
+}
+
+TEST(FramebufferTests, RenderThreadDoesNotBlockProducer) {
+    Presenter presenter(64, 64);
+    std::atomic<bool> release = false;
+    std::vector<int> rendered;
+    RenderThread<int> thread(presenter, [&](const int& value, Framebuffer& fb) {
+        // Медленный кадр: ждёт, пока производитель не закончит
+        while (!release) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        fb.clear(Color::black());
+        rendered.push_back(value);
+    }, 2);
+
+    // Первый снимок уходит в рендер и застревает; очередь из двух переполняется,
+    // старые снимки отбрасываются, а push возвращается сразу
+    thread.push(0);
+    while (thread.snapshots_dropped() == 0) {
+        thread.push(1);
+        thread.push(2);
+        thread.push(3);
+    }
+    release = true;
+    thread.wait_idle();
+
+    ASSERT_GE(rendered.size(), 2u);
+    EXPECT_EQ(rendered.back(), 3);
+    EXPECT_GT(thread.snapshots_dropped(), 0u);
+    EXPECT_TRUE(std::is_sorted(rendered.begin(), rendered.end()));
+}
+
+TEST(FramebufferTests, RenderThreadReportsRenderFailure) {
+    Presenter presenter(64, 64);
+    RenderThread<int> thread(presenter, [](const int&, Framebuffer&) {
+        throw std::runtime_error("render failed");
+    });
+    thread.push(1);
+    EXPECT_THROW(thread.wait_idle(), std::runtime_error);
+    EXPECT_THROW(thread.push(2), std::runtime_error);
+}
@@ -0,0 +1,229 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <numbers>
+#include <stdexcept>
+#include <vector>
+
+#include <Math/Matrix4.hpp>
+#include <Math/Transform.hpp>
+#include <Math/Vector3.hpp>
+#include <Math/Vector4.hpp>
+#include <Scene/Camera.h>
+
+using namespace gmath;
+
+namespace {
+    Matrix4f sample_matrix(float seed) {
+        float values[4][4];
+        for (int i = 0; i < 4; ++i) {
+            for (int j = 0; j < 4; ++j) {
+                values[i][j] = std::sin(seed + float(i * 4 + j)) * 3.0f;
+            }
+        }
+        return Matrix4f(values);
+    }
+
+    Matrix4d to_double(const Matrix4f& m) {
+        double values[4][4];
+        for (int i = 0; i < 4; ++i) {
+            for (int j = 0; j < 4; ++j) {
+                values[i][j] = m(i, j);
+            }
+        }
+        return Matrix4d(values);
+    }
+
+    // Скалярная формула с тем же порядком сложений, что и у SIMD-путей
+    Vector4f reference(const Matrix4f& m, const Vector4f& v) {
+        float out[4];
+        for (int r = 0; r < 4; ++r) {
+            out[r] = m(r, 0) * v.x + m(r, 1) * v.y + m(r, 2) * v.z + m(r, 3) * v.w;
+        }
+        return Vector4f(out[0], out[1], out[2], out[3]);
+    }
+}
+
+// ========================================================
+// 1. Matrix4 / Vector4
+// ========================================================
+
+TEST(MathTests, MatrixProductMatchesScalarLoop) {
+    const Matrix4f a = sample_matrix(0.3f);
+    const Matrix4f b = sample_matrix(1.7f);
+    const Matrix4f product = a * b;
+
+    for (int i = 0; i < 4; ++i) {
+        for (int j = 0; j < 4; ++j) {
+            float sum = 0.0f;
+            for (int k = 0; k < 4; ++k) {
+                sum += a(i, k) * b(k, j);
+            }
+            EXPECT_EQ(product(i, j), sum);
+        }
+    }
+
+    // float и double версии согласованы
+    EXPECT_TRUE(to_double(product).equals(to_double(a) * to_double(b), 1e-4));
+    EXPECT_EQ(a * Matrix4f::edinich(), a);
+}
+
+TEST(MathTests, MatrixVectorProductMatchesScalar) {
+    const Matrix4f m = sample_matrix(2.5f);
+    const Vector4f v(1.5f, -2.0f, 0.25f, 1.0f);
+    EXPECT_EQ(m * v, reference(m, v));
+}
+
+TEST(MathTests, Vector4DotAndNormalize) {
+    const Vector4f v(1.0f, 2.0f, 3.0f, 4.0f);
+    EXPECT_FLOAT_EQ(v.dot(Vector4f(4.0f, 3.0f, 2.0f, 1.0f)), 20.0f);
+    EXPECT_FLOAT_EQ(v.length_squared(), 30.0f);
+
+    const Vector4f n = v.normalized();
+    EXPECT_NEAR(n.length(), 1.0f, 1e-6f);
+    EXPECT_FLOAT_EQ(n.w, 4.0f / std::sqrt(30.0f));
+    EXPECT_EQ(Vector4f().normalized(), Vector4f());
+}
+
+// ========================================================
+// 2. Пакетные преобразования
+// ========================================================
+
+TEST(MathTests, BatchTransformPointsMatchesPerVertex) {
+    const Matrix4f m = sample_matrix(0.9f);
+    // Размер не кратен ни 4, ни 8: проверяется и хвост
+    const size_t count = 37;
+    std::vector<float> x(count), y(count), z(count);
+    for (size_t i = 0; i < count; ++i) {
+        x[i] = float(i) * 0.5f - 3.0f;
+        y[i] = std::cos(float(i));
+        z[i] = float(i % 7) - 2.0f;
+    }
+
+    std::vector<float> ox(count), oy(count), oz(count), ow(count);
+    batch::transform_points(m, x.data(), y.data(), z.data(), count, ox.data(), oy.data(), oz.data(), ow.data());
+
+    for (size_t i = 0; i < count; ++i) {
+        const Vector4f expected = reference(m, Vector4f(x[i], y[i], z[i], 1.0f));
+        EXPECT_EQ(Vector4f(ox[i], oy[i], oz[i], ow[i]), expected) << i;
+    }
+}
+
+TEST(MathTests, BatchTransformVectorsInPlace) {
+    const Matrix4f m = sample_matrix(4.1f);
+    std::vector<Vector4f> vectors;
+    for (int i = 0; i < 11; ++i) {
+        vectors.emplace_back(float(i), float(-i) * 0.5f, 1.0f / float(i + 1), float(i % 2));
+    }
+    const std::vector<Vector4f> original = vectors;
+
+    batch::transform<float>(m, vectors, vectors);
+    for (size_t i = 0; i < vectors.size(); ++i) {
+        EXPECT_EQ(vectors[i], reference(m, original[i])) << i;
+    }
+
+    // double — обычный скалярный путь
+    std::vector<Vector4d> doubles = {Vector4d(1.0, 2.0, 3.0, 1.0)};
+    batch::transform<double>(Matrix4d::edinich(), doubles, doubles);
+    EXPECT_EQ(doubles[0], Vector4d(1.0, 2.0, 3.0, 1.0));
+}
+
+// ========================================================
+// 3. Политика проверок
+// ========================================================
+
+TEST(MathTests, ChecksFollowBuildPolicy) {
+    const Vector3f v(1.f, 2.f, 3.f);
+    const Matrix4f m = Matrix4f::edinich();
+    static_assert(noexcept(v + v));
+    static_assert(noexcept(v / 2.0f) == !checks_enabled);
+    static_assert(noexcept(m(0, 0)) == !checks_enabled);
+
+    if constexpr (checks_enabled) {
+        EXPECT_THROW(v / 0.0f, std::runtime_error);
+        EXPECT_THROW(m(4, 0), std::out_of_range);
+    } else {
+        EXPECT_TRUE(std::isinf((v / 0.0f).x));
+    }
+    EXPECT_EQ(m(3, 3), 1.0f);
+}
+
+// ========================================================
+// 4. constexpr: матрицы на этапе компиляции
+// ========================================================
+
+namespace {
+    constexpr float pi = std::numbers::pi_v<float>;
+
+    // Вычисляются компилятором: при ошибке тест не соберётся
+    constexpr Matrix4d model = Matrix4d::translation(Vector3d(1.0, -2.0, 3.0)) *
+                               Matrix4d::rotation_y(0.5) *
+                               Matrix4d::scale(Vector3d(2.0, 2.0, 2.0));
+
+    static_assert(Matrix4f::edinich() * Matrix4f::edinich() == Matrix4f::edinich());
+    static_assert(Matrix4d::edinich().determinant() == 1.0);
+    static_assert(Matrix4d::scale(Vector3d(2.0, 3.0, 4.0)).determinant() == 24.0);
+    static_assert(cmath::sqrt(16.0) == 4.0);
+    static_assert(cmath::abs(cmath::sin(std::numbers::pi)) < 1e-15);
+    static_assert(Vector3d(3.0, 4.0, 0.0).length() == 5.0);
+    static_assert((model * model.inverse()).equals(Matrix4d::edinich(), 1e-12));
+    static_assert(Matrix4d::translation(Vector3d(1.0, 2.0, 3.0)) * Vector4d(0.0, 0.0, 0.0, 1.0) ==
+                  Vector4d(1.0, 2.0, 3.0, 1.0));
+
+    constexpr Camera camera{
+        {0.0f, 0.0f, 5.0f}, {0.0f, 0.0f, 0.0f}, {0.0f, 1.0f, 0.0f},
+        pi / 2.0f, 16.0f / 9.0f, 1.0f, 10.0f
+    };
+    constexpr Matrix4f view_projection = camera.view_projection();
+    static_assert(Camera::look_direction_vector(camera.target, camera.eye) == Vector3f(0.0f, 0.0f, -5.0f));
+}
+
+TEST(MathTests, ConstexprMatchesRuntime) {
+    // Рантайм-версии идут через std:: и SIMD — результаты совпадают с точностью до округления
+    const Matrix4f runtime_vp = Matrix4f::perspective(pi / 2.0f, 16.0f / 9.0f, 1.0f, 10.0f) *
+                                Matrix4f::look_at(camera.eye, camera.target, camera.up);
+    EXPECT_TRUE(runtime_vp.equals(view_projection, 1e-6f));
+
+    for (double angle : {-7.0, -1.0, 0.25, 2.0, 10.0}) {
+        const Matrix4d rx = Matrix4d::rotation_x(angle);
+        EXPECT_NEAR(rx(1, 1), std::cos(angle), 1e-15);
+        EXPECT_NEAR(rx(2, 1), std::sin(angle), 1e-15);
+    }
+}
+
+TEST(MathTests, PerspectiveMapsNearAndFarPlanes) {
+    // Точка на оси взгляда на ближней плоскости — z / w = -1, на дальней — +1
+    const Vector4f near_point = view_projection * Vector4f(0.0f, 0.0f, 4.0f, 1.0f);
+    const Vector4f far_point = view_projection * Vector4f(0.0f, 0.0f, -5.0f, 1.0f);
+    EXPECT_NEAR(near_point.z / near_point.w, -1.0f, 1e-6f);
+    EXPECT_NEAR(far_point.z / far_point.w, 1.0f, 1e-6f);
+
+    // fov 90°: верхний край на ближней плоскости — y / w = 1
+    const Vector4f top = view_projection * Vector4f(0.0f, 1.0f, 4.0f, 1.0f);
+    EXPECT_NEAR(top.y / top.w, 1.0f, 1e-6f);
+}
+
+TEST(MathTests, InverseAndDeterminant) {
+    // sample_matrix почти вырождена (строки из одной синусоиды), здесь — с диагональным преобладанием
+    auto well_conditioned = [](double seed) {
+        double values[4][4];
+        for (int i = 0; i < 4; ++i) {
+            for (int j = 0; j < 4; ++j) {
+                values[i][j] = std::sin(seed * (i + 1) * (j + 2)) + (i == j ? 4.0 : 0.0);
+            }
+        }
+        return Matrix4d(values);
+    };
+    const Matrix4d m = well_conditioned(0.9);
+    const Matrix4d product = m * m.inverse();
+    EXPECT_TRUE(product.equals(Matrix4d::edinich(), 1e-12));
+
+    // det(A * B) = det(A) * det(B)
+    const Matrix4d other = well_conditioned(2.1);
+    EXPECT_NEAR((m * other).determinant(), m.determinant() * other.determinant(),
+                1e-12 * std::abs(m.determinant() * other.determinant()));
+
+    if constexpr (checks_enabled) {
+        EXPECT_THROW((void)Matrix4d::zero().inverse(), std::runtime_error);
+    }
+}
@@ -0,0 +1,204 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include <Light/Normal.hpp>
+#include <ReadWrite/MeshCache.h>
+#include <ReadWrite/MeshOptimizer.h>
+#include <ReadWrite/Reader.h>
+#include <Render/Mesh.h>
+
+using namespace gmath;
+
+namespace {
+    // Грани меша как наборы атрибутов их углов, без учёта порядка граней и нумерации вершин
+    std::vector<std::vector<float>> face_attributes(const Mesh& mesh) {
+        std::vector<std::vector<float>> result;
+        for (size_t face = 0; face < mesh.face_count(); ++face) {
+            std::vector<float> values;
+            for (uint32_t t = mesh.face_offsets()[face] * 3; t < mesh.face_offsets()[face + 1] * 3; ++t) {
+                const uint32_t v = mesh.indices()[t];
+                for (const float f : {mesh.x()[v], mesh.y()[v], mesh.z()[v], mesh.nx()[v], mesh.ny()[v], mesh.nz()[v]}) {
+                    values.push_back(f);
+                }
+                if (mesh.has_texcoords()) {
+                    values.push_back(mesh.u()[v]);
+                    values.push_back(mesh.v()[v]);
+                }
+            }
+            result.push_back(values);
+        }
+        std::sort(result.begin(), result.end());
+        return result;
+    }
+}
+
+// ========================================================
+// 1. Загрузка и триангуляция
+// ========================================================
+
+TEST(MeshTests, QuadsAreFanTriangulated) {
+    const io::ObjData obj = io::Reader::parse_obj(
+        "v 0 0 0\nv 1 0 0\nv 1 1 0\nv 0 1 0\nv 0.5 2 0\n"
+        "f 1 2 3 4\n"
+        "f 4 3 5\n"
+    );
+    const Mesh mesh = Mesh::from_obj(obj);
+
+    EXPECT_EQ(mesh.vertex_count(), 5u);
+    ASSERT_EQ(mesh.triangle_count(), 3u);
+    ASSERT_EQ(mesh.face_count(), 2u);
+
+    const std::vector<uint32_t> expected = {0, 1, 2, 0, 2, 3, 3, 2, 4};
+    EXPECT_TRUE(std::equal(mesh.indices().begin(), mesh.indices().end(), expected.begin()));
+    EXPECT_EQ(mesh.face_offsets()[1], 2u);
+    EXPECT_EQ(mesh.face_offsets()[2], 3u);
+
+    // Плоская фигура в z = 0: все нормали смотрят по +z
+    ASSERT_TRUE(mesh.has_normals());
+    for (uint32_t i = 0; i < mesh.vertex_count(); ++i) {
+        EXPECT_NEAR(mesh.normal(i).z, 1.0f, 1e-5f);
+    }
+}
+
+TEST(MeshTests, DistinctAttributesSplitVertices) {
+    // Две грани делят позиции 1 и 3, но с разными нормалями
+    const io::ObjData obj = io::Reader::parse_obj(
+        "v 0 0 0\nv 1 0 0\nv 0 1 0\nv 0 0 1\n"
+        "vt 0 0\nvt 1 0\nvt 0 1\n"
+        "vn 0 0 1\nvn 0 1 0\n"
+        "f 1/1/1 2/2/1 3/3/1\n"
+        "f 1/1/2 4/3/2 2/2/2\n"
+    );
+    const Mesh mesh = Mesh::from_obj(obj);
+
+    EXPECT_EQ(mesh.vertex_count(), 6u);
+    ASSERT_TRUE(mesh.has_texcoords());
+    EXPECT_EQ(mesh.texcoord(mesh.indices()[1]), Vector2f(1.0f, 0.0f));
+    EXPECT_EQ(mesh.normal(mesh.indices()[0]), Vector3f(0.0f, 0.0f, 1.0f));
+    EXPECT_EQ(mesh.normal(mesh.indices()[3]), Vector3f(0.0f, 1.0f, 0.0f));
+    EXPECT_EQ(mesh.position(mesh.indices()[3]), mesh.position(mesh.indices()[0]));
+}
+
+TEST(MeshTests, PartialAttributesAreFilledOrRecomputed) {
+    // vt и vn только у второй грани: первая получает vt (0, 0), нормали считаются по граням
+    const io::ObjData obj = io::Reader::parse_obj(
+        "v 0 0 0\nv 1 0 0\nv 0 1 0\nv 1 1 0\n"
+        "vt 0.5 0.5\n"
+        "vn 1 0 0\n"
+        "f 1 2 3\n"
+        "f 2/1/1 4/1/1 3/1/1\n"
+    );
+    const Mesh mesh = Mesh::from_obj(obj);
+
+    ASSERT_EQ(mesh.triangle_count(), 2u);
+    ASSERT_TRUE(mesh.has_texcoords());
+    EXPECT_EQ(mesh.texcoord(mesh.indices()[0]), Vector2f(0.0f, 0.0f));
+    EXPECT_EQ(mesh.texcoord(mesh.indices()[3]), Vector2f(0.5f, 0.5f));
+    ASSERT_TRUE(mesh.has_normals());
+    for (uint32_t i = 0; i < mesh.vertex_count(); ++i) {
+        EXPECT_NEAR(mesh.normal(i).z, 1.0f, 1e-5f);
+    }
+}
+
+TEST(MeshTests, LoadsBoxFromCacheImage) {
+    // build() вместо load(), чтобы не писать кэш в resources
+    const io::MeshCache cache = io::MeshCache::build(
+        io::Reader::read_obj(std::string(KGG_RESOURCES_DIR) + "/models/box.obj"));
+    const Mesh mesh = Mesh::from_cache(cache);
+    EXPECT_EQ(mesh.vertex_count(), 8u);
+    EXPECT_EQ(mesh.triangle_count(), 12u);
+
+    // Потоки выровнены для SIMD-загрузок
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(mesh.x().data()) % 64, 0u);
+    for (uint32_t i = 0; i < mesh.vertex_count(); ++i) {
+        EXPECT_NEAR(mesh.normal(i).length(), 1.0f, 1e-5f);
+    }
+}
+
+TEST(MeshTests, CacheKeepsTexcoordsAndAuthoredNormals) {
+    // Куб-развёртка: позиции общие, у граней свои vt и vn
+    const auto dir = std::filesystem::temp_directory_path() / "kgg_mesh_attributes_test";
+    std::filesystem::remove_all(dir);
+    std::filesystem::create_directories(dir);
+    const std::string obj_path = (dir / "cube.obj").string();
+    {
+        std::ofstream out(obj_path);
+        out << "v -1 -1 -1\nv 1 -1 -1\nv 1 1 -1\nv -1 1 -1\n"
+               "v -1 -1 1\nv 1 -1 1\nv 1 1 1\nv -1 1 1\n"
+               "vt 0 0\nvt 1 0\nvt 1 1\nvt 0 1\n"
+               "vn 0 0 -1\nvn 0 0 1\nvn -1 0 0\nvn 1 0 0\nvn 0 -1 0\nvn 0 1 0\n"
+               "f 1/1/1 4/2/1 3/3/1 2/4/1\nf 5/1/2 6/2/2 7/3/2 8/4/2\n"
+               "f 1/1/3 5/2/3 8/3/3 4/4/3\nf 2/1/4 3/2/4 7/3/4 6/4/4\n"
+               "f 1/1/5 2/2/5 6/3/5 5/4/5\nf 4/1/6 8/2/6 7/3/6 3/4/6\n";
+    }
+
+    const Mesh direct = Mesh::from_obj(io::Reader::read_obj(obj_path));
+    const Mesh first = Mesh::load(obj_path);   // пишет кэш
+    const Mesh cached = Mesh::load(obj_path);  // отображает его
+    ASSERT_TRUE(std::filesystem::exists(io::MeshCache::cache_path_for(obj_path)));
+
+    for (const Mesh* mesh : {&first, &cached}) {
+        EXPECT_EQ(mesh->vertex_count(), direct.vertex_count());
+        EXPECT_EQ(mesh->face_count(), direct.face_count());
+        ASSERT_TRUE(mesh->has_texcoords());
+        EXPECT_EQ(face_attributes(*mesh), face_attributes(direct));
+    }
+
+    // С тем же порядком граней, что у кэша, совпадают и сами потоки
+    io::ObjData optimized = io::Reader::read_obj(obj_path);
+    io::optimizer::optimize(optimized);
+    const Mesh expected = Mesh::from_obj(optimized);
+    EXPECT_TRUE(std::ranges::equal(cached.x(), expected.x()));
+    EXPECT_TRUE(std::ranges::equal(cached.nz(), expected.nz()));
+    EXPECT_TRUE(std::ranges::equal(cached.u(), expected.u()));
+    EXPECT_TRUE(std::ranges::equal(cached.v(), expected.v()));
+    EXPECT_TRUE(std::ranges::equal(cached.indices(), expected.indices()));
+    std::filesystem::remove_all(dir);
+}
+
+// ========================================================
+// 2. Normal поверх MeshView
+// ========================================================
+
+TEST(MeshTests, NormalsFromViewMatchPolygonApi) {
+    const io::ObjData obj = io::Reader::read_obj(std::string(KGG_RESOURCES_DIR) + "/models/octahedron.obj");
+    const Mesh mesh = Mesh::from_obj(obj);
+
+    Normal<float> expected(obj.positions.size(), obj.face_count());
+    const auto polygons = obj.polygons();
+    expected.compute_face_normals(polygons, obj.positions);
+    expected.compute_vertex_normals(polygons, obj.positions);
+
+    Normal<float> actual(mesh.vertex_count(), mesh.triangle_count());
+    actual.compute_face_normals(mesh.view());
+    actual.compute_vertex_normals(mesh.view());
+
+    ASSERT_EQ(mesh.vertex_count(), obj.positions.size());
+    for (size_t i = 0; i < mesh.vertex_count(); ++i) {
+        EXPECT_TRUE(actual.get_vertex_normals()[i].equals(expected.get_vertex_normals()[i], 1e-5f));
+    }
+}
+
+// ========================================================
+// 3. Оптимизация порядка
+// ========================================================
+
+TEST(MeshTests, OptimizeKeepsFacesAndVertexAttributes) {
+    const io::ObjData obj = io::Reader::read_obj(std::string(KGG_RESOURCES_DIR) + "/models/pyramid.obj");
+    const Mesh original = Mesh::from_obj(obj);
+    Mesh optimized = original;
+    optimized.optimize();
+
+    ASSERT_EQ(optimized.vertex_count(), original.vertex_count());
+    ASSERT_EQ(optimized.face_count(), original.face_count());
+    ASSERT_EQ(optimized.triangle_count(), original.triangle_count());
+
+    // Каждая грань остаётся целой: её треугольники с теми же позициями и нормалями
+    EXPECT_EQ(face_attributes(optimized), face_attributes(original));
+}
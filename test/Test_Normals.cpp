@@ -1,6 +1,11 @@
 #include <gtest/gtest.h>
 
+#include <atomic>
+#include <cmath>
+#include <stdexcept>
+
 #include <Light/Normal.hpp>
+#include <Math/Parallel.hpp>
 #include <Math/Vector3.hpp>
 
 using namespace gmath;
@@ -133,3 +138,258 @@ TEST(NormalTests, VertexNormalsAccumulateMultipleFaces) {
         EXPECT_NEAR(v.z, expected.z, 1e-5f);
     }
 }
+
+// ========================================================
+// 4. Parallel computation
+// ========================================================
+
+namespace {
+    // Волнистая сетка n x n квадов, каждый квад — два треугольника
+    void make_grid(int n, std::vector<Vector3f>& vertices, std::vector<std::vector<int>>& polys) {
+        for (int y = 0; y <= n; ++y) {
+            for (int x = 0; x <= n; ++x) {
+                vertices.emplace_back(float(x), float(y), std::sin(x * 0.1f) * std::cos(y * 0.07f) * 3.0f);
+            }
+        }
+        for (int y = 0; y < n; ++y) {
+            for (int x = 0; x < n; ++x) {
+                const int i = y * (n + 1) + x;
+                polys.push_back({i, i + 1, i + n + 2});
+                polys.push_back({i, i + n + 2, i + n + 1});
+            }
+        }
+    }
+}
+
+TEST(NormalTests, ParallelResultMatchesSingleThread) {
+    std::vector<Vector3f> vertices;
+    std::vector<std::vector<int>> polys;
+    make_grid(300, vertices, polys);
+
+    Normal<float> serial(vertices.size(), polys.size());
+    serial.set_thread_count(1);
+    serial.compute_face_normals(polys, vertices);
+    serial.compute_vertex_normals(polys, vertices);
+
+    Normal<float> parallel(vertices.size(), polys.size());
+    parallel.set_thread_count(4);
+    parallel.compute_face_normals(polys, vertices);
+    parallel.compute_vertex_normals(polys, vertices);
+
+    // Каждая нормаль считается одним потоком в том же порядке — результат бит в бит
+    EXPECT_EQ(parallel.get_face_normals(), serial.get_face_normals());
+    EXPECT_EQ(parallel.get_vertex_normals(), serial.get_vertex_normals());
+
+    // Сверка с прямой формулой
+    for (size_t i = 0; i < polys.size(); i += 997) {
+        const Vector3f& a = vertices[polys[i][0]];
+        const Vector3f expected = (vertices[polys[i][1]] - a).cross(vertices[polys[i][2]] - a).normalized();
+        EXPECT_TRUE(serial.get_face_normals()[i].equals(expected, 1e-6f));
+    }
+}
+
+TEST(NormalTests, ParallelForRethrowsAndReusesPool) {
+    // Исключение из куска доходит до вызывающего, а не завершает процесс
+    EXPECT_THROW(parallel_for(1000, 1, 4, [](size_t begin, size_t) {
+        if (begin != 0) {
+            throw std::runtime_error("chunk failed");
+        }
+    }), std::runtime_error);
+
+    // Общий пул остаётся рабочим и после исключения
+    std::atomic<size_t> covered{0};
+    parallel_for(1000, 1, 4, [&](size_t begin, size_t end) {
+        covered += end - begin;
+    });
+    EXPECT_EQ(covered.load(), 1000u);
+}
+
+TEST(NormalTests, AdjacencyIsRebuiltWhenTopologyChanges) {
+    std::vector<Vector3f> vertices = {
+        {0.f, 0.f, 0.f},
+        {1.f, 0.f, 0.f},
+        {0.f, 1.f, 0.f},
+        {0.f, 0.f, 1.f}
+    };
+    std::vector<std::vector<int>> polys = {
+        {0, 1, 2},
+        {0, 2, 3}
+    };
+
+    Normal<float> n(vertices.size(), polys.size());
+    n.compute_face_normals(polys, vertices);
+    n.compute_vertex_normals(polys, vertices);
+    EXPECT_TRUE(n.get_vertex_normals()[1].equals(Vector3f(0.f, 0.f, 1.f), 1e-6f));
+
+    // Та же топология по размерам, но вершина 1 теперь во второй грани вместо 3
+    polys[1] = {0, 2, 1};
+    n.invalidate_adjacency();
+    n.compute_face_normals(polys, vertices);
+    n.compute_vertex_normals(polys, vertices);
+    EXPECT_EQ(n.get_vertex_normals()[3], Vector3f::Null());
+    EXPECT_EQ(n.get_vertex_normals()[1], Vector3f::Null());
+}
+
+// ========================================================
+// 5. Incremental update
+// ========================================================
+
+TEST(NormalTests, IncrementalUpdateMatchesFullRecompute) {
+    std::vector<Vector3f> vertices;
+    std::vector<std::vector<int>> polys;
+    make_grid(40, vertices, polys);
+
+    Normal<float> incremental(vertices.size(), polys.size());
+    incremental.compute_face_normals(polys, vertices);
+    incremental.compute_vertex_normals(polys, vertices);
+
+    // Несколько шагов «редактирования»: двигаем пару вершин, в том числе на краю
+    const std::vector<std::vector<uint32_t>> edits = {{0}, {820, 821}, {1680}, {820}};
+    for (const auto& modified : edits) {
+        for (uint32_t v : modified) {
+            vertices[v].z += 1.5f;
+            vertices[v].x -= 0.25f;
+        }
+        incremental.update_normals(modified, polys, vertices);
+
+        Normal<float> full(vertices.size(), polys.size());
+        full.compute_face_normals(polys, vertices);
+        full.compute_vertex_normals(polys, vertices);
+
+        EXPECT_EQ(incremental.get_face_normals(), full.get_face_normals());
+        EXPECT_EQ(incremental.get_vertex_normals(), full.get_vertex_normals());
+    }
+}
+
+TEST(NormalTests, UpdateWithoutAdjacencyRecomputesEverything) {
+    std::vector<Vector3f> vertices;
+    std::vector<std::vector<int>> polys;
+    make_grid(8, vertices, polys);
+
+    Normal<float> n(vertices.size(), polys.size());
+    n.update_normals(std::vector<uint32_t>{3}, polys, vertices);
+
+    Normal<float> full(vertices.size(), polys.size());
+    full.compute_face_normals(polys, vertices);
+    full.compute_vertex_normals(polys, vertices);
+    EXPECT_EQ(n.get_vertex_normals(), full.get_vertex_normals());
+}
+
+TEST(NormalTests, UpdateKeepsComputeAllWeighting) {
+    std::vector<Vector3f> vertices;
+    std::vector<std::vector<int>> polys;
+    make_grid(40, vertices, polys);
+
+    for (const NormalWeighting weighting : {NormalWeighting::area, NormalWeighting::angle}) {
+        Normal<float> incremental(vertices.size(), polys.size());
+        incremental.compute_all(polys, vertices, weighting);
+
+        // Вершины не двигались: нормали не меняются
+        const std::vector<Vector3f> before = incremental.get_vertex_normals();
+        incremental.update_normals(std::vector<uint32_t>{0, 820}, polys, vertices);
+        EXPECT_EQ(incremental.get_vertex_normals(), before);
+
+        std::vector<Vector3f> moved = vertices;
+        moved[820].z += 1.5f;
+        incremental.update_normals(std::vector<uint32_t>{820}, polys, moved);
+
+        Normal<float> full(moved.size(), polys.size());
+        full.compute_all(polys, moved, weighting);
+        EXPECT_EQ(incremental.get_face_normals(), full.get_face_normals());
+        EXPECT_EQ(incremental.get_vertex_normals(), full.get_vertex_normals());
+    }
+}
+
+// ========================================================
+// 6. Fused pass with weighting
+// ========================================================
+
+TEST(NormalTests, ComputeAllUniformMatchesTwoPassVersion) {
+    std::vector<Vector3f> vertices;
+    std::vector<std::vector<int>> polys;
+    make_grid(300, vertices, polys);
+
+    Normal<float> two_pass(vertices.size(), polys.size());
+    two_pass.compute_face_normals(polys, vertices);
+    two_pass.compute_vertex_normals(polys, vertices);
+
+    Normal<float> fused(vertices.size(), polys.size());
+    fused.set_thread_count(4);
+    fused.compute_all(polys, vertices, NormalWeighting::uniform);
+
+    EXPECT_EQ(fused.get_face_normals(), two_pass.get_face_normals());
+    for (size_t i = 0; i < vertices.size(); ++i) {
+        ASSERT_TRUE(fused.get_vertex_normals()[i].equals(two_pass.get_vertex_normals()[i], 1e-5f)) << i;
+    }
+}
+
+TEST(NormalTests, ComputeAllParallelGatherMatchesFusedPass) {
+    std::vector<Vector3f> vertices;
+    std::vector<std::vector<int>> polys;
+    make_grid(300, vertices, polys);
+
+    for (const NormalWeighting weighting : {NormalWeighting::uniform, NormalWeighting::area, NormalWeighting::angle}) {
+        Normal<float> fused(vertices.size(), polys.size());
+        fused.set_thread_count(1);
+        fused.compute_all(polys, vertices, weighting);
+
+        Normal<float> gathered(vertices.size(), polys.size());
+        gathered.set_thread_count(4);
+        gathered.compute_all(polys, vertices, weighting);
+
+        // Те же вклады в том же порядке граней — результат бит в бит
+        EXPECT_EQ(gathered.get_face_normals(), fused.get_face_normals());
+        EXPECT_EQ(gathered.get_vertex_normals(), fused.get_vertex_normals());
+    }
+}
+
+TEST(NormalTests, AreaWeightingFavoursLargerFaces) {
+    // Вершина 0 общая для большого треугольника в z = 0 и маленького в x = 0
+    std::vector<Vector3f> vertices = {
+        {0.f, 0.f, 0.f},
+        {10.f, 0.f, 0.f},
+        {0.f, 10.f, 0.f},
+        {0.f, 1.f, 0.f},
+        {0.f, 0.f, 1.f}
+    };
+    std::vector<std::vector<int>> polys = {
+        {0, 1, 2},
+        {0, 3, 4}
+    };
+
+    Normal<float> uniform(vertices.size(), polys.size());
+    uniform.compute_all(polys, vertices, NormalWeighting::uniform);
+    Normal<float> area(vertices.size(), polys.size());
+    area.compute_all(polys, vertices, NormalWeighting::area);
+
+    EXPECT_NEAR(uniform.get_vertex_normals()[0].x, uniform.get_vertex_normals()[0].z, 1e-6f);
+    // 100 : 1 по площади
+    const Vector3f expected = Vector3f(1.f, 0.f, 100.f).normalized();
+    EXPECT_TRUE(area.get_vertex_normals()[0].equals(expected, 1e-6f));
+}
+
+TEST(NormalTests, AngleWeightingIgnoresTriangulation) {
+    // Угол куба: грань x = 0 задана квадом, грани y = 0 и z = 0 — по два треугольника.
+    // С весом по углу нормаль угла — ровно диагональ
+    std::vector<Vector3f> vertices = {
+        {0.f, 0.f, 0.f},
+        {1.f, 0.f, 0.f},
+        {0.f, 1.f, 0.f},
+        {0.f, 0.f, 1.f},
+        {1.f, 1.f, 0.f},
+        {1.f, 0.f, 1.f},
+        {0.f, 1.f, 1.f}
+    };
+    std::vector<std::vector<int>> polys = {
+        {0, 3, 6, 2},          // x = 0, нормаль -x
+        {0, 1, 5}, {0, 5, 3},  // y = 0, нормаль -y
+        {0, 2, 4}, {0, 4, 1}   // z = 0, нормаль -z
+    };
+
+    Normal<float> n(vertices.size(), polys.size());
+    n.compute_all(polys, vertices, NormalWeighting::angle);
+
+    EXPECT_TRUE(n.get_face_normals()[0].equals(Vector3f(-1.f, 0.f, 0.f), 1e-6f));
+    const float d = -1.0f / std::sqrt(3.0f);
+    EXPECT_TRUE(n.get_vertex_normals()[0].equals(Vector3f(d, d, d), 1e-6f));
+}
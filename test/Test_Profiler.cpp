@@ -0,0 +1,186 @@
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <Profile/Profiler.h>
+
+using namespace profile;
+
+namespace {
+    // Профайлер общий на процесс: каждый тест начинает с пустых колец
+    class ProfilerTests : public ::testing::Test {
+        protected:
+            void SetUp() override {
+                profiler.set_enabled(true);
+                profiler.stop_capture();
+                profiler.collect();
+            }
+
+            void TearDown() override {
+                profiler.stop_capture();
+                profiler.set_enabled(false);
+            }
+
+            Profiler& profiler = Profiler::instance();
+    };
+
+    std::size_t count_of(const std::string& text, const std::string& what) {
+        std::size_t count = 0;
+        for (std::size_t at = text.find(what); at != std::string::npos; at = text.find(what, at + 1)) {
+            ++count;
+        }
+        return count;
+    }
+}
+
+// ========================================================
+// 1. Этапы и счётчики
+// ========================================================
+
+TEST_F(ProfilerTests, ScopedTimerRecordsStage) {
+    {
+        KGG_PROFILE_SCOPE(raster);
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    }
+
+    const FrameStats stats = profiler.collect();
+    EXPECT_GE(stats.stage_ms[static_cast<std::size_t>(Stage::raster)], 2.0);
+    EXPECT_EQ(stats.stage_ms[static_cast<std::size_t>(Stage::clear)], 0.0);
+    EXPECT_EQ(profiler.last().stage_ms, stats.stage_ms);
+}
+
+TEST_F(ProfilerTests, CountersSumAcrossThreadsPerCollect) {
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t) {
+        threads.emplace_back([] {
+            for (int i = 0; i < 1000; ++i) {
+                KGG_PROFILE_COUNT(pixels_shaded, 3);
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    KGG_PROFILE_COUNT(triangles_culled, 5);
+
+    const FrameStats stats = profiler.collect();
+    EXPECT_EQ(stats.counters[static_cast<std::size_t>(Counter::pixels_shaded)], 12000u);
+    EXPECT_EQ(stats.counters[static_cast<std::size_t>(Counter::triangles_culled)], 5u);
+
+    // Приращение с прошлого collect, а не сумма с начала
+    const FrameStats next = profiler.collect();
+    EXPECT_EQ(next.counters[static_cast<std::size_t>(Counter::pixels_shaded)], 0u);
+}
+
+TEST_F(ProfilerTests, DisabledProfilerRecordsNothing) {
+    profiler.set_enabled(false);
+    {
+        KGG_PROFILE_SCOPE(frame);
+        KGG_PROFILE_COUNT(triangles_submitted, 10);
+    }
+    profiler.set_enabled(true);
+
+    const FrameStats stats = profiler.collect();
+    EXPECT_EQ(stats.stage_ms[static_cast<std::size_t>(Stage::frame)], 0.0);
+    EXPECT_EQ(stats.counters[static_cast<std::size_t>(Counter::triangles_submitted)], 0u);
+}
+
+TEST_F(ProfilerTests, HistoryKeepsFramesInOrder) {
+    for (std::uint64_t frame = 1; frame <= 3; ++frame) {
+        KGG_PROFILE_COUNT(triangles_rasterized, frame);
+        profiler.collect();
+    }
+
+    std::vector<float> values;
+    profiler.counter_history(Counter::triangles_rasterized, values);
+    ASSERT_GE(values.size(), 3u);
+    EXPECT_FLOAT_EQ(values[values.size() - 3], 1.0f);
+    EXPECT_FLOAT_EQ(values[values.size() - 2], 2.0f);
+    EXPECT_FLOAT_EQ(values.back(), 3.0f);
+}
+
+// ========================================================
+// 2. Кольцо событий
+// ========================================================
+
+TEST(EventRingTests, OverflowDropsAndCounts) {
+    EventRing ring;
+    for (std::size_t i = 0; i < EventRing::CAPACITY; ++i) {
+        ASSERT_TRUE(ring.push({static_cast<std::int64_t>(i), 1, 0, Stage::tile}));
+    }
+    EXPECT_FALSE(ring.push({0, 1, 0, Stage::tile}));
+    EXPECT_EQ(ring.dropped(), 1u);
+
+    Event event{};
+    ASSERT_TRUE(ring.pop(event));
+    EXPECT_EQ(event.start_ns, 0);
+    EXPECT_TRUE(ring.push({-1, 1, 0, Stage::tile}));
+
+    std::size_t popped = 1;
+    while (ring.pop(event)) {
+        ++popped;
+    }
+    EXPECT_EQ(popped, EventRing::CAPACITY + 1);
+    EXPECT_EQ(event.start_ns, -1);
+}
+
+TEST(EventRingTests, ConcurrentProducerAndCollector) {
+    EventRing ring;
+    constexpr std::int64_t COUNT = 100000;
+    std::thread producer([&] {
+        for (std::int64_t i = 0; i < COUNT; ++i) {
+            while (!ring.push({i, 0, 0, Stage::tile})) {
+                std::this_thread::yield();
+            }
+        }
+    });
+
+    // События приходят по порядку и без пропусков, хотя кольцо переполняется
+    std::int64_t expected = 0;
+    Event event{};
+    while (expected < COUNT) {
+        if (ring.pop(event)) {
+            ASSERT_EQ(event.start_ns, expected);
+            ++expected;
+        }
+    }
+    producer.join();
+    EXPECT_FALSE(ring.pop(event));
+}
+
+// ========================================================
+// 3. Chrome trace
+// ========================================================
+
+TEST_F(ProfilerTests, ChromeTraceHasStagesThreadsAndCounters) {
+    profiler.start_capture();
+    {
+        KGG_PROFILE_SCOPE(frame);
+        std::thread worker([] {
+            KGG_PROFILE_SCOPE(tile);
+            KGG_PROFILE_COUNT(pixels_shaded, 42);
+        });
+        worker.join();
+    }
+    profiler.collect();
+    profiler.stop_capture();
+    EXPECT_EQ(profiler.captured_events(), 2u);
+
+    std::ostringstream out;
+    profiler.write_chrome_trace(out);
+    const std::string trace = out.str();
+
+    EXPECT_NE(trace.find("\"traceEvents\""), std::string::npos);
+    EXPECT_EQ(count_of(trace, "\"ph\":\"X\""), 2u);
+    EXPECT_NE(trace.find("\"name\":\"frame\""), std::string::npos);
+    EXPECT_NE(trace.find("\"name\":\"tile\""), std::string::npos);
+    EXPECT_NE(trace.find("\"pixels\":42"), std::string::npos);
+    // Два потока — две дорожки с именами
+    EXPECT_GE(count_of(trace, "\"thread_name\""), 2u);
+    EXPECT_EQ(trace.front(), '{');
+    EXPECT_EQ(trace.substr(trace.size() - 3), "]}\n");
+}
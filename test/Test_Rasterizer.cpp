@@ -0,0 +1,759 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cstring>
+#include <limits>
+#include <numbers>
+#include <random>
+#include <set>
+#include <stdexcept>
+
+#include <Math/Matrix4.hpp>
+#include <Profile/Profiler.h>
+#include <ReadWrite/Reader.h>
+#include <Render/Rasterizer.h>
+#include <Render/Clipper.h>
+#include <Render/Interpolator.h>
+#include <Render/Mesh.h>
+#include <Render/Render.h>
+#include <Render/RasterizerSimd.h>
+#include <Render/ShaderPipeline.h>
+#include <Render/ThreadPool.h>
+#include <Render/TiledRenderer.h>
+#include <Render/VertexStage.h>
+#include <Window/Framebuffer.h>
+
+using namespace render;
+using gmath::Vector2f;
+
+namespace {
+    constexpr uint32_t W = 64;
+    constexpr uint32_t H = 64;
+
+    bool covered(const Framebuffer& fb, uint32_t x, uint32_t y) {
+        return fb.get_data()[(y * fb.get_width() + x) * 4] != 0;
+    }
+
+    int count_covered(const Framebuffer& fb) {
+        int count = 0;
+        for (uint32_t y = 0; y < fb.get_height(); ++y) {
+            for (uint32_t x = 0; x < fb.get_width(); ++x) {
+                count += covered(fb, x, y);
+            }
+        }
+        return count;
+    }
+
+    // Каждый пиксель квадрата закрашен ровно одним из двух треугольников
+    void expect_exact_partition(Vector2f a, Vector2f b, Vector2f c, Vector2f d, int expected) {
+        Framebuffer first(W, H);
+        Framebuffer second(W, H);
+        first.clear(Color::black());
+        second.clear(Color::black());
+
+        Rasterizer::draw_triangle(first, a, b, c, Color::white());
+        Rasterizer::draw_triangle(second, a, c, d, Color::white());
+
+        int overlap = 0;
+        for (uint32_t y = 0; y < H; ++y) {
+            for (uint32_t x = 0; x < W; ++x) {
+                overlap += covered(first, x, y) && covered(second, x, y);
+            }
+        }
+
+        EXPECT_EQ(overlap, 0);
+        EXPECT_EQ(count_covered(first) + count_covered(second), expected);
+    }
+}
+
+// ========================================================
+// 1. Fill rule
+// ========================================================
+
+TEST(RasterizerTests, SharedDiagonalHasNoOverdrawOrCracks) {
+    expect_exact_partition({8.f, 8.f}, {40.f, 8.f}, {40.f, 32.f}, {8.f, 32.f}, 32 * 24);
+}
+
+TEST(RasterizerTests, SharedDiagonalReversedWinding) {
+    expect_exact_partition({8.f, 8.f}, {8.f, 32.f}, {40.f, 32.f}, {40.f, 8.f}, 32 * 24);
+}
+
+TEST(RasterizerTests, SubpixelQuadPartition) {
+    // Вершины на половинах пикселей: центры лежат ровно на рёбрах
+    expect_exact_partition({3.5f, 2.5f}, {20.5f, 2.5f}, {20.5f, 12.5f}, {3.5f, 12.5f}, 17 * 10);
+}
+
+TEST(RasterizerTests, DegenerateTriangleDrawsNothing) {
+    Framebuffer fb(W, H);
+    fb.clear(Color::black());
+    Rasterizer::draw_triangle(fb, {1.f, 1.f}, {10.f, 10.f}, {20.f, 20.f}, Color::white());
+    EXPECT_EQ(count_covered(fb), 0);
+}
+
+// ========================================================
+// 2. Clipping to the framebuffer
+// ========================================================
+
+TEST(RasterizerTests, OffscreenVerticesAreClamped) {
+    Framebuffer fb(W, H);
+    fb.clear(Color::black());
+    Rasterizer::draw_triangle(fb, {-1000.f, -1000.f}, {3000.f, -1000.f}, {-1000.f, 3000.f}, Color::white());
+    EXPECT_TRUE(covered(fb, 0, 0));
+    EXPECT_TRUE(covered(fb, W - 1, 0));
+    EXPECT_TRUE(covered(fb, 0, H - 1));
+}
+
+TEST(RasterizerTests, NonFiniteVerticesAreRejected) {
+    const float nan = std::numeric_limits<float>::quiet_NaN();
+    const float inf = std::numeric_limits<float>::infinity();
+    const Rect clip{0, 0, int(W), int(H)};
+    EXPECT_FALSE(TriangleSetup::create({nan, 0.f}, {60.f, 0.f}, {0.f, 60.f}, clip));
+    EXPECT_FALSE(TriangleSetup::create({0.f, 0.f}, {inf, 0.f}, {0.f, 60.f}, clip));
+    EXPECT_FALSE(TriangleSetup::create({0.f, 0.f}, {60.f, 0.f}, {0.f, -inf}, clip));
+
+    Framebuffer fb(W, H);
+    fb.clear(Color::black());
+    Rasterizer::draw_triangle(fb, {nan, nan}, {60.f, 0.f}, {0.f, 60.f}, Color::white());
+    EXPECT_EQ(count_covered(fb), 0);
+}
+
+TEST(RasterizerTests, HugeVerticesDoNotOverflow) {
+    const Rect clip{0, 0, int(W), int(H)};
+    // За пределом 28.4 в int64 — отказ вместо переполнения
+    EXPECT_FALSE(TriangleSetup::create({-1e9f, -1e9f}, {3e9f, -1e9f}, {-1e9f, 3e9f}, clip));
+
+    // У предела — треугольник закрывает весь буфер
+    const float far = MAX_COORDINATE;
+    Framebuffer fb(W, H);
+    fb.clear(Color::black());
+    Rasterizer::draw_triangle(fb, {-far / 2, -far / 2}, {far, -far / 2}, {-far / 2, far}, Color::white());
+    EXPECT_EQ(count_covered(fb), int(W * H));
+}
+
+// ========================================================
+// 3. Interpolation
+// ========================================================
+
+TEST(RasterizerTests, ColoredTriangleHitsVertexColors) {
+    Framebuffer fb(W, H);
+    fb.clear(Color::black());
+    Rasterizer::draw_colored_triangle(
+        fb,
+        {0.f, 0.f}, {60.f, 0.f}, {0.f, 60.f},
+        Color::red(), Color::green(), Color::blue()
+    );
+
+    const uint8_t* px = fb.get_data();
+    EXPECT_GT(px[0], 240);                 // около a — красный
+    EXPECT_GT(px[(0 * W + 58) * 4 + 1], 200); // около b — зелёный
+    EXPECT_GT(px[(58 * W + 0) * 4 + 2], 200); // около c — синий
+}
+
+// ========================================================
+// 4. SIMD kernels
+// ========================================================
+
+namespace {
+    void draw_random_scene(Framebuffer& fb, simd::Isa isa) {
+        simd::force_isa(isa);
+        fb.clear(Color::black());
+
+        std::mt19937 rng(42);
+        std::uniform_real_distribution<float> coord(-10.f, 74.f);
+        for (int i = 0; i < 200; ++i) {
+            Vector2f a(coord(rng), coord(rng));
+            Vector2f b(coord(rng), coord(rng));
+            Vector2f c(coord(rng), coord(rng));
+            if (i % 2 == 0) {
+                Rasterizer::draw_triangle(fb, a, b, c, Color(uint8_t(i), 100, 200, 255));
+            } else {
+                Rasterizer::draw_colored_triangle(fb, a, b, c, Color::red(), Color::green(), Color::blue());
+            }
+        }
+    }
+}
+
+TEST(RasterizerTests, SimdPathsMatchScalar) {
+    Framebuffer reference(W, H);
+    draw_random_scene(reference, simd::Isa::scalar);
+
+    for (simd::Isa isa : {simd::Isa::sse2, simd::Isa::avx2}) {
+        Framebuffer fb(W, H);
+        draw_random_scene(fb, isa);
+        EXPECT_EQ(std::memcmp(fb.get_data(), reference.get_data(), W * H * 4), 0)
+            << "isa " << static_cast<int>(simd::active_isa());
+    }
+
+    simd::force_isa(simd::detect_isa());
+}
+
+// ========================================================
+// 5. Tiled renderer
+// ========================================================
+
+TEST(RasterizerTests, TiledRendererMatchesSerial) {
+    constexpr uint32_t width = 300;
+    constexpr uint32_t height = 200;
+
+    Framebuffer serial(width, height);
+    Framebuffer tiled(width, height);
+    serial.clear(Color::black());
+    tiled.clear(Color::black());
+
+    ThreadPool pool(3);
+    TiledRenderer renderer(pool);
+    renderer.begin_frame(tiled);
+
+    std::mt19937 rng(7);
+    std::uniform_real_distribution<float> x(-50.f, 350.f);
+    std::uniform_real_distribution<float> y(-50.f, 250.f);
+    for (int i = 0; i < 300; ++i) {
+        Vector2f a(x(rng), y(rng));
+        Vector2f b(x(rng), y(rng));
+        Vector2f c(x(rng), y(rng));
+        const Color color(uint8_t(i), uint8_t(i * 7), 255, 255);
+        if (i % 3 == 0) {
+            Rasterizer::draw_colored_triangle(serial, a, b, c, Color::red(), color, Color::blue());
+            renderer.draw_colored_triangle(a, b, c, Color::red(), color, Color::blue());
+        } else {
+            Rasterizer::draw_triangle(serial, a, b, c, color);
+            renderer.draw_triangle(a, b, c, color);
+        }
+    }
+    renderer.end_frame();
+
+    EXPECT_EQ(std::memcmp(serial.get_data(), tiled.get_data(), width * height * 4), 0);
+}
+
+TEST(RasterizerTests, ThreadPoolRethrowsTaskException) {
+    ThreadPool pool(3);
+    std::atomic<int> finished{0};
+    EXPECT_THROW(
+        pool.parallel_for(1000, [&](std::size_t i) {
+            if (i == 10) {
+                throw std::runtime_error("task failed");
+            }
+            finished.fetch_add(1);
+        }),
+        std::runtime_error);
+    EXPECT_LT(finished.load(), 1000);
+
+    // Пул остаётся рабочим
+    std::atomic<int> sum{0};
+    pool.parallel_for(100, [&](std::size_t i) { sum.fetch_add(int(i)); });
+    EXPECT_EQ(sum.load(), 4950);
+}
+
+// ========================================================
+// 6. Depth test
+// ========================================================
+
+TEST(RasterizerTests, NearTriangleWinsRegardlessOfOrder) {
+    using gmath::Vector3f;
+    const Vector3f far_a(0.f, 0.f, 0.8f), far_b(60.f, 0.f, 0.8f), far_c(0.f, 60.f, 0.8f);
+    const Vector3f near_a(10.f, 10.f, 0.2f), near_b(50.f, 10.f, 0.2f), near_c(10.f, 50.f, 0.2f);
+
+    Framebuffer first(W, H);
+    first.clear(Color::black());
+    first.clear_depth();
+    Rasterizer::draw_triangle(first, far_a, far_b, far_c, Color::red());
+    Rasterizer::draw_triangle(first, near_a, near_b, near_c, Color::green());
+
+    Framebuffer second(W, H);
+    second.clear(Color::black());
+    second.clear_depth();
+    Rasterizer::draw_triangle(second, near_a, near_b, near_c, Color::green());
+    Rasterizer::draw_triangle(second, far_a, far_b, far_c, Color::red());
+
+    EXPECT_EQ(std::memcmp(first.get_data(), second.get_data(), W * H * 4), 0);
+    EXPECT_EQ(first.get_row(20)[20], Color::green().to_rgba32());
+    EXPECT_EQ(first.get_row(2)[2], Color::red().to_rgba32());
+    EXPECT_FLOAT_EQ(first.get_depth_row(20)[20], 0.2f);
+}
+
+TEST(RasterizerTests, HiddenTriangleLeavesBufferUntouched) {
+    using gmath::Vector3f;
+    Framebuffer fb(W, H);
+    fb.clear(Color::black());
+    fb.clear_depth();
+    Rasterizer::draw_triangle(fb, Vector3f(-10.f, -10.f, 0.1f), Vector3f(200.f, -10.f, 0.1f),
+                              Vector3f(-10.f, 200.f, 0.1f), Color::blue());
+    Rasterizer::draw_colored_triangle(fb, Vector3f(5.f, 5.f, 0.5f), Vector3f(40.f, 5.f, 0.6f),
+                                      Vector3f(5.f, 40.f, 0.7f), Color::red(), Color::green(), Color::white());
+    EXPECT_EQ(count_covered(fb), 0); // красный канал нигде не записан
+    EXPECT_EQ(fb.get_row(10)[10], Color::blue().to_rgba32());
+}
+
+TEST(RasterizerTests, TiledDepthMatchesSerial) {
+    using gmath::Vector3f;
+    constexpr uint32_t width = 200;
+    constexpr uint32_t height = 150;
+
+    Framebuffer serial(width, height);
+    Framebuffer tiled(width, height);
+    for (Framebuffer* fb : {&serial, &tiled}) {
+        fb->clear(Color::black());
+        fb->clear_depth();
+    }
+
+    ThreadPool pool(2);
+    TiledRenderer renderer(pool);
+    renderer.begin_frame(tiled);
+
+    std::mt19937 rng(3);
+    std::uniform_real_distribution<float> x(-20.f, 220.f);
+    std::uniform_real_distribution<float> y(-20.f, 170.f);
+    std::uniform_real_distribution<float> z(0.f, 1.f);
+    for (int i = 0; i < 150; ++i) {
+        Vector3f a(x(rng), y(rng), z(rng));
+        Vector3f b(x(rng), y(rng), z(rng));
+        Vector3f c(x(rng), y(rng), z(rng));
+        const Color color(uint8_t(i), 40, 90, 255);
+        Rasterizer::draw_colored_triangle(serial, a, b, c, color, Color::green(), Color::blue());
+        renderer.draw_colored_triangle(a, b, c, color, Color::green(), Color::blue());
+    }
+    renderer.end_frame();
+
+    EXPECT_EQ(std::memcmp(serial.get_data(), tiled.get_data(), width * height * 4), 0);
+}
+
+// ========================================================
+// 7. Clipping
+// ========================================================
+
+TEST(RasterizerTests, ClipperPassesVisibleTriangleUnchanged) {
+    Clipper clipper({0.f, 0.f, 800.f, 600.f});
+    const auto polygon = clipper.clip_triangle(
+        {-0.5f, -0.5f, 0.f, 1.f}, {0.5f, -0.5f, 0.f, 1.f}, {0.f, 0.5f, 0.f, 1.f});
+
+    ASSERT_EQ(polygon.count, 3);
+    EXPECT_FLOAT_EQ(polygon.vertices[0].position.x, 200.f);
+    EXPECT_FLOAT_EQ(polygon.vertices[0].position.y, 450.f);
+    EXPECT_FLOAT_EQ(polygon.vertices[0].position.z, 0.5f);
+    EXPECT_FLOAT_EQ(polygon.vertices[2].position.y, 150.f);
+}
+
+TEST(RasterizerTests, ClipperRejectsTriangleOutsideViewport) {
+    Clipper clipper({0.f, 0.f, 800.f, 600.f});
+    const auto polygon = clipper.clip_triangle(
+        {1.5f, 0.f, 0.f, 1.f}, {3.f, 0.f, 0.f, 1.f}, {2.f, 1.f, 0.f, 1.f});
+    EXPECT_EQ(polygon.count, 0);
+}
+
+TEST(RasterizerTests, ClipperKeepsGuardBandTrianglesWhole) {
+    // Вылезает за viewport, но не за guard band — без новых вершин
+    Clipper clipper({0.f, 0.f, 800.f, 600.f}, 4.f);
+    const auto polygon = clipper.clip_triangle(
+        {-0.5f, 0.f, 0.f, 1.f}, {3.f, 0.f, 0.f, 1.f}, {0.f, 0.9f, 0.f, 1.f});
+    EXPECT_EQ(polygon.count, 3);
+}
+
+TEST(RasterizerTests, ClipperCutsNearPlaneAndInterpolatesWeights) {
+    Clipper clipper({0.f, 0.f, 100.f, 100.f});
+    // Вершина c за near-плоскостью (z < -w)
+    const auto polygon = clipper.clip_triangle(
+        {-0.5f, 0.f, 0.f, 1.f}, {0.5f, 0.f, 0.f, 1.f}, {0.f, 0.5f, -3.f, 1.f});
+
+    ASSERT_EQ(polygon.count, 4);
+    for (int i = 0; i < polygon.count; ++i) {
+        const ScreenVertex& v = polygon.vertices[i];
+        EXPECT_GE(v.position.z, -1e-6f);
+        EXPECT_NEAR(v.barycentric.x + v.barycentric.y + v.barycentric.z, 1.f, 1e-5f);
+    }
+}
+
+// ========================================================
+// 8. Vertex stage
+// ========================================================
+
+namespace {
+    // Простая перспектива: w = -z, z_ndc = (z * (f + n) / (n - f) + 2fn / (n - f)) / w
+    gmath::Matrix4f perspective(float n, float f) {
+        const float values[4][4] = {
+            {1.f, 0.f, 0.f, 0.f},
+            {0.f, 1.f, 0.f, 0.f},
+            {0.f, 0.f, (f + n) / (n - f), 2.f * f * n / (n - f)},
+            {0.f, 0.f, -1.f, 0.f}
+        };
+        return gmath::Matrix4f(values);
+    }
+}
+
+TEST(RasterizerTests, VertexStageMatchesPerVertexTransform) {
+    ThreadPool pool(3);
+    VertexStage stage(pool);
+    Clipper clipper({10.f, 20.f, 640.f, 480.f});
+    const gmath::Matrix4f mvp = perspective(0.1f, 100.f);
+
+    // Несколько блоков + неполный хвост
+    const size_t count = VertexStage::BLOCK_SIZE * 3 + 17;
+    std::vector<float> x(count), y(count), z(count);
+    for (size_t i = 0; i < count; ++i) {
+        x[i] = std::sin(float(i)) * 5.f;
+        y[i] = std::cos(float(i) * 0.7f) * 5.f;
+        z[i] = -2.f - float(i % 50);
+    }
+    z[5] = 1.f;        // за камерой
+    x[6] = 1000.f;     // за guard band
+
+    stage.process(x, y, z, mvp, clipper);
+    ASSERT_EQ(stage.size(), count);
+
+    for (size_t i = 0; i < count; ++i) {
+        const gmath::Vector4f clip = mvp * gmath::Vector4f(x[i], y[i], z[i], 1.f);
+        ASSERT_EQ(stage.clip(uint32_t(i)), clip) << i;
+        if (i == 5 || i == 6) {
+            EXPECT_TRUE(stage.needs_clipping(uint32_t(i)));
+            continue;
+        }
+        ASSERT_FALSE(stage.needs_clipping(uint32_t(i))) << i;
+
+        // Тот же результат, что у Clipper для невырезанного треугольника
+        const gmath::Vector4f center(0.f, 0.f, 0.f, 1.f);
+        const auto polygon = clipper.clip_triangle(clip, center, center);
+        ASSERT_EQ(polygon.count, 3);
+        EXPECT_EQ(stage.screen(uint32_t(i)), polygon.vertices[0].position) << i;
+    }
+}
+
+TEST(RasterizerTests, VertexStageSendsNonFiniteToClipper) {
+    ThreadPool pool(1);
+    VertexStage stage(pool);
+    const Clipper clipper({0.f, 0.f, float(W), float(H)});
+    const gmath::Matrix4f mvp = perspective(0.1f, 100.f);
+
+    const float nan = std::numeric_limits<float>::quiet_NaN();
+    const float inf = std::numeric_limits<float>::infinity();
+    const std::vector<float> x = {0.f, nan, 0.f, inf, 0.f};
+    const std::vector<float> y = {0.f, 0.f, nan, 0.f, 0.f};
+    const std::vector<float> z = {-2.f, -2.f, -2.f, -2.f, nan};
+
+    stage.process(x, y, z, mvp, clipper);
+    EXPECT_FALSE(stage.needs_clipping(0));
+    for (uint32_t i = 1; i < 5; ++i) {
+        EXPECT_TRUE(stage.needs_clipping(i)) << i;
+    }
+}
+
+TEST(RasterizerTests, RenderMeshCoversViewport) {
+    // Квадрат на весь NDC и треугольник, уходящий за камеру
+    const Mesh mesh = Mesh::from_obj(io::Reader::parse_obj(
+        "v -1 -1 0.5\nv 1 -1 0.5\nv 1 1 0.5\nv -1 1 0.5\n"
+        "f 1 2 3 4\n"
+    ));
+    const Mesh behind = Mesh::from_obj(io::Reader::parse_obj(
+        "v -0.5 -0.5 0\nv 0.5 -0.5 0\nv 0 0.5 -3\n"
+        "f 1 2 3\n"
+    ));
+
+    ThreadPool pool(2);
+    VertexStage stage(pool);
+    TiledRenderer renderer(pool);
+    const Clipper clipper({0.f, 0.f, float(W), float(H)});
+    const gmath::Matrix4f identity = gmath::Matrix4f::edinich();
+
+    Framebuffer fb(W, H);
+    fb.clear(Color::black());
+    fb.clear_depth();
+    renderer.begin_frame(fb);
+    Render::render(mesh, identity, clipper, stage, renderer, Color::white());
+    renderer.end_frame();
+    EXPECT_EQ(count_covered(fb), int(W * H));
+
+    fb.clear(Color::black());
+    fb.clear_depth();
+    renderer.begin_frame(fb);
+    Render::render(behind, identity, clipper, stage, renderer, Color::white());
+    renderer.end_frame();
+    const int visible = count_covered(fb);
+    EXPECT_GT(visible, 0);
+    // Отрезанная часть не рисуется: меньше, чем весь треугольник
+    EXPECT_LT(visible, int(W * H) / 4);
+}
+
+
+// ========================================================
+// 9. Attribute interpolation
+// ========================================================
+
+namespace {
+    // a = (0, 0), b = (64, 0), c = (0, 64): барицентрические координаты центра пикселя
+    void barycentric(int x, int y, float& la, float& lb, float& lc) {
+        lb = (float(x) + 0.5f) / 64.f;
+        lc = (float(y) + 0.5f) / 64.f;
+        la = 1.f - lb - lc;
+    }
+}
+
+TEST(RasterizerTests, InterpolatorAffineMatchesBarycentric) {
+    // Порядок вершин с отрицательной площадью: проверяется и перестановка b, c
+    const auto setup = TriangleSetup::create({0.f, 0.f}, {64.f, 0.f}, {0.f, 64.f}, Rect{0, 0, 64, 64});
+    ASSERT_TRUE(setup);
+    ASSERT_TRUE(setup->swapped);
+
+    using Interp = Interpolator<2>;
+    const Interp::Values values[3] = {{1.f, 10.f}, {3.f, -4.f}, {-2.f, 7.f}};
+    const Interp interpolator(*setup, values);
+    EXPECT_FALSE(interpolator.perspective());
+
+    for (int y = 0; y < 40; y += 3) {
+        auto cursor = interpolator.at(0, y);
+        for (int x = 0; x < 64 - y; ++x) {
+            float la, lb, lc;
+            barycentric(x, y, la, lb, lc);
+            const Interp::Values v = cursor.get();
+            EXPECT_NEAR(v[0], la * 1.f + lb * 3.f + lc * -2.f, 1e-4f) << x << ", " << y;
+            EXPECT_NEAR(v[1], la * 10.f + lb * -4.f + lc * 7.f, 1e-4f) << x << ", " << y;
+            cursor.step();
+        }
+    }
+}
+
+TEST(RasterizerTests, InterpolatorPerspectiveCorrect) {
+    const auto setup = TriangleSetup::create({0.f, 0.f}, {0.f, 64.f}, {64.f, 0.f}, Rect{0, 0, 64, 64});
+    ASSERT_TRUE(setup);
+
+    using Interp = Interpolator<1>;
+    const Interp::Values values[3] = {{0.f}, {1.f}, {2.f}};
+    const float inv_w[3] = {1.f, 0.25f, 0.5f};
+    const Interp interpolator(*setup, values, inv_w);
+    EXPECT_TRUE(interpolator.perspective());
+
+    for (int y = 0; y < 60; y += 7) {
+        auto cursor = interpolator.at(0, y);
+        for (int x = 0; x < 64 - y; ++x) {
+            float la, lb, lc;
+            barycentric(x, y, la, lc, lb); // b и c поменялись местами на экране
+            const float q = la * inv_w[0] + lb * inv_w[1] + lc * inv_w[2];
+            const float expected = (lb * inv_w[1] * 1.f + lc * inv_w[2] * 2.f) / q;
+            EXPECT_NEAR(cursor.get()[0], expected, 1e-4f) << x << ", " << y;
+            EXPECT_NEAR(interpolator.value_at(x, y)[0], expected, 1e-5f) << x << ", " << y;
+            cursor.step();
+        }
+    }
+}
+
+TEST(RasterizerTests, TiledPerspectiveColorMatchesSerial) {
+    constexpr uint32_t width = 200;
+    constexpr uint32_t height = 150;
+
+    Framebuffer serial(width, height);
+    Framebuffer tiled(width, height);
+    for (Framebuffer* fb : {&serial, &tiled}) {
+        fb->clear(Color::black());
+        fb->clear_depth();
+    }
+
+    ThreadPool pool(2);
+    TiledRenderer renderer(pool);
+    renderer.begin_frame(tiled);
+
+    std::mt19937 rng(11);
+    std::uniform_real_distribution<float> x(-20.f, 220.f);
+    std::uniform_real_distribution<float> y(-20.f, 170.f);
+    std::uniform_real_distribution<float> unit(0.05f, 1.f);
+    auto vertex = [&] {
+        return ScreenVertex{{x(rng), y(rng), unit(rng)}, unit(rng), {}};
+    };
+    for (int i = 0; i < 100; ++i) {
+        const ScreenVertex a = vertex(), b = vertex(), c = vertex();
+        const Color color(uint8_t(i * 3), 200, 40, 255);
+        Rasterizer::draw_colored_triangle(serial, a, b, c, color, Color::green(), Color::blue());
+        renderer.draw_colored_triangle(a, b, c, color, Color::green(), Color::blue());
+    }
+    renderer.end_frame();
+
+    EXPECT_EQ(std::memcmp(serial.get_data(), tiled.get_data(), width * height * 4), 0);
+}
+
+// ========================================================
+// 10. Shaders
+// ========================================================
+
+namespace {
+    // Квадрат [-1, 1]^2 в плоскости z = 0, нормаль +z
+    Mesh make_plane() {
+        return Mesh::from_obj(io::Reader::parse_obj(
+            "v -1 -1 0\nv 1 -1 0\nv 1 1 0\nv -1 1 0\n"
+            "f 1 2 3 4\n"
+        ));
+    }
+
+    // Двускатная крыша: гребень x = 0 приподнят, вершины гребня общие
+    Mesh make_roof() {
+        return Mesh::from_obj(io::Reader::parse_obj(
+            "v -1 -1 0\nv 0 -1 0.5\nv 0 1 0.5\nv -1 1 0\nv 1 -1 0\nv 1 1 0\n"
+            "f 1 2 3 4\nf 2 5 6 3\n"
+        ));
+    }
+
+    constexpr gmath::Matrix4f view_projection =
+        gmath::Matrix4f::perspective(std::numbers::pi_v<float> / 3.f, 1.f, 0.1f, 10.f) *
+        gmath::Matrix4f::look_at({0.f, 0.f, 3.f}, {0.f, 0.f, 0.f}, {0.f, 1.f, 0.f});
+
+    template<Shader S>
+    Framebuffer draw_with(const Mesh& mesh, const S& shader) {
+        ThreadPool pool(2);
+        VertexStage stage(pool);
+        ShaderPipeline<S> pipeline(pool);
+        const Clipper clipper({0.f, 0.f, float(W), float(H)});
+
+        Framebuffer fb(W, H);
+        fb.clear(Color::black());
+        fb.clear_depth();
+        pipeline.draw(mesh, shader, view_projection, clipper, stage, fb);
+        return fb;
+    }
+
+    std::set<std::uint32_t> shaded_colors(const Framebuffer& fb) {
+        std::set<std::uint32_t> colors;
+        for (uint32_t y = 0; y < fb.get_height(); ++y) {
+            for (uint32_t x = 0; x < fb.get_width(); ++x) {
+                if (fb.get_row(y)[x] != Color::black().to_rgba32()) {
+                    colors.insert(fb.get_row(y)[x]);
+                }
+            }
+        }
+        return colors;
+    }
+}
+
+TEST(RasterizerTests, ShadersLightPlaneFacingLight) {
+    // Свет по нормали: ambient + diffuse = 1, цвет материала без изменений
+    const Mesh plane = make_plane();
+    const auto normals = triangle_normals(plane);
+    const Color base(200, 100, 50, 255);
+    const Light light;
+
+    const Framebuffer flat = draw_with(plane, FlatShader{base, light, normals});
+    const Framebuffer gouraud = draw_with(plane, GouraudShader{base, light});
+    const Framebuffer phong = draw_with(plane, PhongShader{base, light});
+
+    for (const Framebuffer* fb : {&flat, &gouraud, &phong}) {
+        EXPECT_EQ(shaded_colors(*fb), std::set<std::uint32_t>{base.to_rgba32()});
+        EXPECT_EQ(fb->get_row(H / 2)[W / 2], base.to_rgba32());
+    }
+    EXPECT_EQ(std::memcmp(flat.get_data(), phong.get_data(), W * H * 4), 0);
+}
+
+TEST(RasterizerTests, ShadersNeedingNormalsRejectMeshWithout) {
+    const Mesh empty;
+    ASSERT_FALSE(empty.has_normals());
+    EXPECT_THROW(draw_with(empty, GouraudShader{}), std::invalid_argument);
+    EXPECT_THROW(draw_with(empty, PhongShader{}), std::invalid_argument);
+    EXPECT_NO_THROW(draw_with(empty, FlatShader{}));
+}
+
+TEST(RasterizerTests, FlatShadingIsConstantPerTriangle) {
+    const Mesh roof = make_roof();
+    const auto normals = triangle_normals(roof);
+    Light light;
+    light.direction = gmath::Vector3f(0.6f, 0.f, 0.8f);
+
+    // Два ската — два цвета; по Гуро общие вершины гребня дают плавный переход
+    const Framebuffer flat = draw_with(roof, FlatShader{Color::white(), light, normals});
+    EXPECT_EQ(shaded_colors(flat).size(), 2u);
+
+    const Framebuffer gouraud = draw_with(roof, GouraudShader{Color::white(), light});
+    EXPECT_GT(shaded_colors(gouraud).size(), 4u);
+}
+
+TEST(RasterizerTests, PhongHighlightBetweenVertices) {
+    // Блик в центре квадрата: вершины его не видят, Гуро интерполирует тёмные углы
+    const Mesh plane = make_plane();
+    Light light;
+    light.ambient = 0.f;
+    light.diffuse = 0.5f;
+    light.specular = 1.f;
+    light.shininess = 64.f;
+    light.eye = gmath::Vector3f(0.f, 0.f, 3.f);
+
+    const Framebuffer phong = draw_with(plane, PhongShader{Color(100, 100, 100, 255), light});
+    const Framebuffer gouraud = draw_with(plane, GouraudShader{Color(100, 100, 100, 255), light});
+
+    const auto red = [](const Framebuffer& fb, uint32_t x, uint32_t y) { return fb.get_row(y)[x] & 0xFFu; };
+    EXPECT_EQ(red(phong, W / 2, H / 2), 255u);
+    EXPECT_LT(red(gouraud, W / 2, H / 2), 200u);
+    // К краю блик слабеет
+    EXPECT_GT(red(phong, W / 2, H / 2), red(phong, W / 2 + 16, H / 2));
+}
+
+// ========================================================
+// 11. Profiler counters
+// ========================================================
+
+namespace {
+    std::uint64_t counter(const profile::FrameStats& stats, profile::Counter which) {
+        return stats.counters[static_cast<std::size_t>(which)];
+    }
+
+    // Видимый, вырожденный и целиком за экраном треугольники
+    template<class Draw>
+    void draw_counted_scene(Draw&& draw) {
+        draw(Vector2f(4.f, 4.f), Vector2f(60.f, 10.f), Vector2f(20.f, 58.f));
+        draw(Vector2f(1.f, 1.f), Vector2f(2.f, 2.f), Vector2f(3.f, 3.f));
+        draw(Vector2f(-40.f, -40.f), Vector2f(-10.f, -40.f), Vector2f(-20.f, -10.f));
+    }
+}
+
+TEST(RasterizerTests, ProfilerCountsTrianglesAndPixels) {
+    profile::Profiler& profiler = profile::Profiler::instance();
+    profiler.set_enabled(true);
+
+    for (simd::Isa isa : {simd::Isa::scalar, simd::Isa::sse2, simd::Isa::avx2}) {
+        simd::force_isa(isa);
+        Framebuffer fb(W, H);
+        fb.clear(Color::black());
+        profiler.collect();
+
+        draw_counted_scene([&](Vector2f a, Vector2f b, Vector2f c) {
+            Rasterizer::draw_colored_triangle(fb, a, b, c, Color::red(), Color::red(), Color::white());
+        });
+        const profile::FrameStats stats = profiler.collect();
+
+        EXPECT_EQ(counter(stats, profile::Counter::triangles_submitted), 3u);
+        EXPECT_EQ(counter(stats, profile::Counter::triangles_culled), 2u);
+        EXPECT_EQ(counter(stats, profile::Counter::triangles_rasterized), 1u);
+        EXPECT_EQ(counter(stats, profile::Counter::pixels_shaded), static_cast<std::uint64_t>(count_covered(fb)))
+            << "isa " << static_cast<int>(simd::active_isa());
+    }
+    simd::force_isa(simd::detect_isa());
+
+    // Тест глубины: закрытый треугольник не закрашивает ни одного пикселя
+    Framebuffer fb(W, H);
+    fb.clear(Color::black());
+    fb.clear_depth();
+    Rasterizer::draw_triangle(fb, {0.f, 0.f, 0.2f}, {64.f, 0.f, 0.2f}, {0.f, 64.f, 0.2f}, Color::red());
+    profiler.collect();
+    Rasterizer::draw_triangle(fb, {0.f, 0.f, 0.8f}, {64.f, 0.f, 0.8f}, {0.f, 64.f, 0.8f}, Color::white());
+    EXPECT_EQ(counter(profiler.collect(), profile::Counter::pixels_shaded), 0u);
+
+    profiler.set_enabled(false);
+}
+
+TEST(RasterizerTests, ProfilerCountsTiledFrame) {
+    profile::Profiler& profiler = profile::Profiler::instance();
+    profiler.set_enabled(true);
+
+    Framebuffer fb(W, H);
+    fb.clear(Color::black());
+    ThreadPool pool(3);
+    TiledRenderer renderer(pool);
+    profiler.collect();
+
+    renderer.begin_frame(fb);
+    draw_counted_scene([&](Vector2f a, Vector2f b, Vector2f c) {
+        renderer.draw_triangle(a, b, c, Color::red());
+    });
+    renderer.end_frame();
+    const profile::FrameStats stats = profiler.collect();
+
+    EXPECT_EQ(counter(stats, profile::Counter::triangles_submitted), 3u);
+    EXPECT_EQ(counter(stats, profile::Counter::triangles_culled), 2u);
+    EXPECT_EQ(counter(stats, profile::Counter::triangles_rasterized), 1u);
+    // Тайлы делят треугольник без перекрытий: пикселей столько же, сколько закрашено
+    EXPECT_EQ(counter(stats, profile::Counter::pixels_shaded), static_cast<std::uint64_t>(count_covered(fb)));
+    EXPECT_GT(stats.stage_ms[static_cast<std::size_t>(profile::Stage::raster)], 0.0);
+
+    profiler.set_enabled(false);
+}
@@ -0,0 +1,402 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+
+#include <ReadWrite/ImageWriter.h>
+#include <ReadWrite/MeshCache.h>
+#include <ReadWrite/MeshOptimizer.h>
+#include <ReadWrite/Reader.h>
+#include <Window/Framebuffer.h>
+
+using namespace io;
+
+namespace {
+    // Много копий одного куба: 8 вершин, 2 нормали, 6 граней на копию,
+    // грани ссылаются на вершины отрицательными индексами
+    std::string make_cubes(int count) {
+        std::string text = "# cubes\nmtllib cubes.mtl\n";
+        for (int i = 0; i < count; ++i) {
+            text += "o Cube" + std::to_string(i) + "\r\n";
+            for (int v = 0; v < 8; ++v) {
+                text += "v " + std::to_string(i + (v & 1)) + ".5 " +
+                        std::to_string((v >> 1) & 1) + " -" + std::to_string((v >> 2) & 1) + "e0\n";
+            }
+            text += "vn 0 0 1\nvn 0 1 0\n";
+            text += "usemtl Material\ns off\n";
+            text += "f -8//-1 -7//-1 -5//-1 -6//-1\n";
+            text += "f -4//-2 -3//-2 -1//-2 -2//-2\n";
+            text += "f -8 -7 -3 -4\nf -6 -5 -1 -2\nf -8 -6 -2 -4\nf -7 -5 -1 -3\n";
+        }
+        return text;
+    }
+}
+
+// ========================================================
+// 1. Разбор
+// ========================================================
+
+TEST(ReaderTests, ParsesAllFaceFormats) {
+    const ObjData data = Reader::parse_obj(
+        "v 0 0 0\n"
+        "v 1.5 -2 3e2\n"
+        "v -0.25 .5 +1E-1\n"
+        "vt 0 0\n"
+        "vt 1 1\n"
+        "vn 0 0 1\n"
+        "f 1 2 3\n"
+        "f 1/1 2/2 3/1\n"
+        "f 1//1 2//1 3//1\n"
+        "f 1/2/1 2/1/1 -1/-1/-1\n"
+    );
+
+    ASSERT_EQ(data.positions.size(), 3u);
+    EXPECT_FLOAT_EQ(data.positions[1].x, 1.5f);
+    EXPECT_FLOAT_EQ(data.positions[1].y, -2.0f);
+    EXPECT_FLOAT_EQ(data.positions[1].z, 300.0f);
+    EXPECT_FLOAT_EQ(data.positions[2].x, -0.25f);
+    EXPECT_FLOAT_EQ(data.positions[2].y, 0.5f);
+    EXPECT_FLOAT_EQ(data.positions[2].z, 0.1f);
+    EXPECT_EQ(data.texcoords.size(), 2u);
+    EXPECT_EQ(data.normals.size(), 1u);
+
+    ASSERT_EQ(data.face_count(), 4u);
+    EXPECT_EQ(data.texcoord_indices[0], ObjData::NO_INDEX);
+    EXPECT_EQ(data.normal_indices[0], ObjData::NO_INDEX);
+    EXPECT_EQ(data.texcoord_indices[4], 1u);
+    EXPECT_EQ(data.texcoord_indices[6], ObjData::NO_INDEX);
+    EXPECT_EQ(data.normal_indices[6], 0u);
+    EXPECT_EQ(data.position_indices[11], 2u);
+    EXPECT_EQ(data.texcoord_indices[11], 1u);
+    EXPECT_EQ(data.normal_indices[11], 0u);
+}
+
+TEST(ReaderTests, OutOfRangeIndexThrows) {
+    EXPECT_THROW(Reader::parse_obj("v 0 0 0\nv 1 0 0\nf 1 2 3\n"), std::runtime_error);
+    EXPECT_THROW(Reader::parse_obj("v 0 0 0\nf 1 -2 1\n"), std::runtime_error);
+}
+
+TEST(ReaderTests, IndexBeyondUint32IsBadFace) {
+    const std::string vertices = "v 0 0 0\nv 1 0 0\nv 0 1 0\n";
+    // 2^32 + 1 не должен превратиться в вершину 0
+    for (const char* face : {"f 4294967297 2 3\n", "f 1/99999999999999999999999 2 3\n", "f 1 2 -4294967296\n"}) {
+        try {
+            Reader::parse_obj(vertices + face);
+            FAIL() << face;
+        } catch (const std::runtime_error& e) {
+            EXPECT_NE(std::string(e.what()).find("bad face at line 4"), std::string::npos) << e.what();
+        }
+    }
+}
+
+// ========================================================
+// 2. Многопоточность
+// ========================================================
+
+TEST(ReaderTests, ParallelParseMatchesSerial) {
+    // Несколько мегабайт, чтобы текст действительно разбился на куски
+    const std::string text = make_cubes(40000);
+    const ObjData serial = Reader::parse_obj(text, 1);
+    const ObjData parallel = Reader::parse_obj(text, 4);
+
+    ASSERT_EQ(serial.face_count(), 40000u * 6);
+    ASSERT_EQ(parallel.positions.size(), serial.positions.size());
+    for (size_t i = 0; i < serial.positions.size(); ++i) {
+        ASSERT_EQ(parallel.positions[i].x, serial.positions[i].x);
+        ASSERT_EQ(parallel.positions[i].y, serial.positions[i].y);
+        ASSERT_EQ(parallel.positions[i].z, serial.positions[i].z);
+    }
+    EXPECT_EQ(parallel.normals.size(), serial.normals.size());
+    EXPECT_EQ(parallel.position_indices, serial.position_indices);
+    EXPECT_EQ(parallel.normal_indices, serial.normal_indices);
+    EXPECT_EQ(parallel.face_offsets, serial.face_offsets);
+
+    // Отрицательные индексы последнего куба указывают на его же вершины
+    EXPECT_EQ(parallel.position_indices.back(), 40000u * 8 - 3);
+}
+
+// ========================================================
+// 3. Файл
+// ========================================================
+
+TEST(ReaderTests, ReadsBoxModel) {
+    const ObjData data = Reader::read_obj(std::string(KGG_RESOURCES_DIR) + "/models/box.obj");
+    EXPECT_EQ(data.positions.size(), 8u);
+    EXPECT_EQ(data.face_count(), 12u);
+    EXPECT_FLOAT_EQ(data.positions[5].x, 0.999999f);
+
+    const auto polygons = data.polygons();
+    ASSERT_EQ(polygons.size(), 12u);
+    EXPECT_EQ(polygons[0], (std::vector<int>{4, 0, 3}));
+}
+
+TEST(ReaderTests, MissingFileThrows) {
+    EXPECT_THROW(Reader::read_obj("/nonexistent/model.obj"), std::runtime_error);
+}
+
+// ========================================================
+// 4. Бинарный кэш
+// ========================================================
+
+namespace {
+    // Копия box.obj во временном каталоге, чтобы кэш не писался в resources
+    std::filesystem::path copy_box(const std::string& name) {
+        const auto dir = std::filesystem::temp_directory_path() / name;
+        std::filesystem::remove_all(dir);
+        std::filesystem::create_directories(dir);
+        const auto path = dir / "box.obj";
+        std::filesystem::copy_file(std::string(KGG_RESOURCES_DIR) + "/models/box.obj", path);
+        return path;
+    }
+}
+
+TEST(MeshCacheTests, FirstLoadWritesCacheSecondLoadMapsIt) {
+    const std::string obj_path = copy_box("kgg_mesh_cache_test").string();
+    const std::string cache_path = MeshCache::cache_path_for(obj_path);
+
+    const MeshCache first = MeshCache::load(obj_path);
+    ASSERT_TRUE(std::filesystem::exists(cache_path));
+
+    const MeshCache second = MeshCache::load(obj_path);
+    EXPECT_TRUE(second.is_mapped());
+    ASSERT_EQ(second.vertex_count(), 8u);
+    ASSERT_EQ(second.face_count(), 12u);
+
+    // Кэш хранит оптимизированный порядок
+    ObjData obj = Reader::read_obj(obj_path);
+    optimizer::optimize(obj);
+    for (size_t i = 0; i < obj.positions.size(); ++i) {
+        EXPECT_EQ(second.positions()[i], obj.positions[i]);
+        EXPECT_NEAR(second.normals()[i].length(), 1.0f, 1e-5f);
+    }
+    EXPECT_TRUE(std::equal(second.indices().begin(), second.indices().end(), obj.position_indices.begin()));
+    EXPECT_TRUE(std::equal(second.face_offsets().begin(), second.face_offsets().end(), obj.face_offsets.begin()));
+
+    EXPECT_EQ(second.bounds_min(), gmath::Vector3f(-1.0f, -1.0f, -1.0f));
+    EXPECT_FLOAT_EQ(second.bounds_max().z, 1.000001f);
+
+    // Угол куба: нормаль смотрит по диагонали
+    EXPECT_NEAR(second.normals()[0].x, 1.0f / std::sqrt(3.0f), 0.2f);
+}
+
+TEST(MeshCacheTests, ModifiedSourceRebuildsCache) {
+    const auto obj_path = copy_box("kgg_mesh_cache_stale_test");
+    ASSERT_EQ(MeshCache::load(obj_path.string()).face_count(), 12u);
+
+    {
+        std::ofstream out(obj_path, std::ios::app);
+        out << "v 5 5 5\nf 1 2 9\n";
+    }
+    const MeshCache reloaded = MeshCache::load(obj_path.string());
+    EXPECT_EQ(reloaded.vertex_count(), 9u);
+    EXPECT_EQ(reloaded.face_count(), 13u);
+    EXPECT_FLOAT_EQ(reloaded.bounds_max().x, 5.0f);
+}
+
+TEST(MeshCacheTests, CorruptedCacheIsRejected) {
+    const auto obj_path = copy_box("kgg_mesh_cache_corrupt_test");
+    const std::string cache_path = MeshCache::cache_path_for(obj_path.string());
+    {
+        std::ofstream out(cache_path, std::ios::binary);
+        out << "KGGM garbage";
+    }
+    EXPECT_THROW(MeshCache::open(cache_path), std::runtime_error);
+
+    // load() молча пересобирает кэш
+    EXPECT_EQ(MeshCache::load(obj_path.string()).face_count(), 12u);
+    EXPECT_NO_THROW(MeshCache::open(cache_path));
+}
+
+TEST(MeshCacheTests, OutOfRangeIndicesAndFacesAreRejected) {
+    const auto obj_path = copy_box("kgg_mesh_cache_index_test");
+    const std::string cache_path = MeshCache::cache_path_for(obj_path.string());
+    ASSERT_EQ(MeshCache::load(obj_path.string()).face_count(), 12u);
+    const MeshCacheHeader header = MeshCache::open(cache_path).header();
+
+    // Секции на месте, но содержимое испорчено
+    auto patch = [&](std::uint64_t offset, std::uint32_t value) {
+        std::fstream file(cache_path, std::ios::binary | std::ios::in | std::ios::out);
+        file.seekp(static_cast<std::streamoff>(offset));
+        file.write(reinterpret_cast<const char*>(&value), sizeof(value));
+    };
+
+    patch(header.indices_offset + 5 * sizeof(std::uint32_t), header.vertex_count);
+    EXPECT_THROW(MeshCache::open(cache_path), std::runtime_error);
+    EXPECT_EQ(MeshCache::load(obj_path.string()).vertex_count(), 8u);
+    EXPECT_NO_THROW(MeshCache::open(cache_path));
+
+    patch(header.faces_offset + 1 * sizeof(std::uint32_t), 7);
+    EXPECT_THROW(MeshCache::open(cache_path), std::runtime_error);
+    EXPECT_EQ(MeshCache::load(obj_path.string()).face_count(), 12u);
+
+    // Временные файлы записи не остаются рядом с кэшем
+    for (const auto& entry : std::filesystem::directory_iterator(obj_path.parent_path())) {
+        EXPECT_EQ(entry.path().string().find(".tmp"), std::string::npos) << entry.path();
+    }
+}
+
+// ========================================================
+// 5. Оптимизация порядка
+// ========================================================
+
+namespace {
+    // Сетка n x n квадов, треугольники построчно — плохой порядок для кэша
+    ObjData make_grid(int n) {
+        std::string text;
+        for (int y = 0; y <= n; ++y) {
+            for (int x = 0; x <= n; ++x) {
+                text += "v " + std::to_string(x) + " " + std::to_string(y) + " 0\n";
+            }
+        }
+        for (int y = 0; y < n; ++y) {
+            for (int x = 0; x < n; ++x) {
+                const int i = y * (n + 1) + x + 1;
+                text += "f " + std::to_string(i) + " " + std::to_string(i + 1) + " " + std::to_string(i + n + 2) + "\n";
+                text += "f " + std::to_string(i) + " " + std::to_string(i + n + 2) + " " + std::to_string(i + n + 1) + "\n";
+            }
+        }
+        return Reader::parse_obj(text);
+    }
+}
+
+TEST(OptimizerTests, TipsifyImprovesCacheMissRatio) {
+    ObjData obj = make_grid(64);
+    const float before = optimizer::average_cache_miss_ratio(obj.position_indices);
+
+    // Те же треугольники до и после, как множество троек позиций
+    auto triangles = [](const ObjData& data) {
+        std::vector<std::array<float, 9>> result;
+        for (size_t face = 0; face < data.face_count(); ++face) {
+            std::array<float, 9> t{};
+            for (int k = 0; k < 3; ++k) {
+                const gmath::Vector3f& p = data.positions[data.position_indices[data.face_offsets[face] + k]];
+                t[k * 3] = p.x;
+                t[k * 3 + 1] = p.y;
+                t[k * 3 + 2] = p.z;
+            }
+            result.push_back(t);
+        }
+        std::sort(result.begin(), result.end());
+        return result;
+    };
+    const auto original = triangles(obj);
+
+    optimizer::optimize(obj);
+    const float after = optimizer::average_cache_miss_ratio(obj.position_indices);
+
+    EXPECT_GT(before, 0.9f);
+    EXPECT_LT(after, 0.7f);
+    EXPECT_EQ(triangles(obj), original);
+
+    // Вершины пронумерованы по первому использованию
+    uint32_t next = 0;
+    for (const uint32_t v : obj.position_indices) {
+        ASSERT_LE(v, next);
+        next = std::max(next, v + 1);
+    }
+}
+
+
+// ========================================================
+// 6. Запись кадров
+// ========================================================
+
+namespace {
+    render::Framebuffer make_test_frame() {
+        render::Framebuffer fb(70, 3);
+        fb.clear(render::Color(1, 2, 3, 255));
+        fb.set_pixel(0, 0, render::Color(10, 20, 30, 40));
+        fb.set_pixel(69, 2, render::Color(50, 60, 70, 80));
+        return fb;
+    }
+
+    uint32_t read_u32_be(const std::string& data, size_t offset) {
+        return (uint32_t(uint8_t(data[offset])) << 24) | (uint32_t(uint8_t(data[offset + 1])) << 16) |
+               (uint32_t(uint8_t(data[offset + 2])) << 8) | uint32_t(uint8_t(data[offset + 3]));
+    }
+}
+
+TEST(ImageWriterTests, FormatFollowsExtension) {
+    EXPECT_EQ(format_for_path("a/b.ppm"), ImageFormat::ppm);
+    EXPECT_EQ(format_for_path("frame_01.PNG"), ImageFormat::png);
+    EXPECT_EQ(format_for_path("video.raw"), ImageFormat::raw);
+    EXPECT_EQ(format_for_path("-"), ImageFormat::raw);
+}
+
+TEST(ImageWriterTests, PpmIsBinaryRgb) {
+    const render::Framebuffer fb = make_test_frame();
+    std::ostringstream out;
+    write_ppm(out, fb);
+    const std::string data = out.str();
+
+    const std::string header = "P6\n70 3\n255\n";
+    ASSERT_EQ(data.size(), header.size() + 70 * 3 * 3);
+    EXPECT_EQ(data.substr(0, header.size()), header);
+    EXPECT_EQ(data.substr(header.size(), 6), std::string("\x0A\x14\x1E\x01\x02\x03", 6));
+    EXPECT_EQ(data.substr(data.size() - 3), std::string("\x32\x3C\x46", 3));
+}
+
+TEST(ImageWriterTests, RawIsRowMajorRgba) {
+    const render::Framebuffer fb = make_test_frame();
+    std::ostringstream out;
+    write_raw(out, fb);
+    write_raw(out, fb);
+    const std::string data = out.str();
+
+    ASSERT_EQ(data.size(), 2u * 70 * 3 * 4);
+    EXPECT_EQ(data.substr(0, 4), std::string("\x0A\x14\x1E\x28", 4));
+    EXPECT_EQ(data.substr(70 * 3 * 4 - 4, 4), std::string("\x32\x3C\x46\x50", 4));
+}
+
+TEST(ImageWriterTests, PngStoresScanlinesUncompressed) {
+    // 3 строки по 70 * 4 + 1 байт: больше одного stored-блока не нужно, зато
+    // кадр 200x100 требует нескольких — проверяем оба случая
+    for (const auto& [width, height] : {std::pair{70u, 3u}, std::pair{200u, 100u}}) {
+        render::Framebuffer fb(width, height);
+        fb.clear(render::Color(1, 2, 3, 255));
+        fb.set_pixel(int(width) - 1, int(height) - 1, render::Color(50, 60, 70, 80));
+        std::ostringstream out;
+        write_png(out, fb);
+        const std::string data = out.str();
+
+        ASSERT_EQ(data.substr(0, 8), std::string("\x89PNG\r\n\x1A\n", 8));
+        EXPECT_EQ(data.substr(12, 4), "IHDR");
+        EXPECT_EQ(read_u32_be(data, 16), width);
+        EXPECT_EQ(read_u32_be(data, 20), height);
+        EXPECT_EQ(data[24], 8); // бит на канал
+        EXPECT_EQ(data[25], 6); // RGBA
+
+        // IEND с известной CRC
+        EXPECT_EQ(data.substr(data.size() - 12), std::string("\0\0\0\0IEND\xAE\x42\x60\x82", 12));
+
+        // Разбор zlib: заголовок, stored-блоки, adler32
+        const size_t idat = 8 + 25;
+        ASSERT_EQ(data.substr(idat + 4, 4), "IDAT");
+        const std::string zlib = data.substr(idat + 8, read_u32_be(data, idat));
+        size_t pos = 2;
+        std::string scanlines;
+        bool last = false;
+        while (!last) {
+            last = zlib[pos] & 1;
+            EXPECT_EQ(zlib[pos] & 6, 0); // BTYPE = 00
+            const size_t length = uint8_t(zlib[pos + 1]) | (uint8_t(zlib[pos + 2]) << 8);
+            const size_t inverse = uint8_t(zlib[pos + 3]) | (uint8_t(zlib[pos + 4]) << 8);
+            EXPECT_EQ(length ^ inverse, 0xFFFFu);
+            scanlines += zlib.substr(pos + 5, length);
+            pos += 5 + length;
+        }
+        EXPECT_EQ(pos + 4, zlib.size());
+
+        const size_t row = width * 4 + 1;
+        ASSERT_EQ(scanlines.size(), row * height);
+        EXPECT_EQ(scanlines[0], 0); // фильтр None
+        EXPECT_EQ(scanlines.substr(1, 4), std::string("\x01\x02\x03\xFF", 4));
+        EXPECT_EQ(scanlines.substr(scanlines.size() - 4), std::string("\x32\x3C\x46\x50", 4));
+    }
+}